@@ -149,38 +149,111 @@ void zephir_is_basic_charset(zval *return_value, const zval *param){
 	RETURN_STRING("ISO-8859-1", 1);
 }
 
-static long zephir_unpack(char *data, int size, int issigned, int *map)
-{
-	long result;
-	char *cresult = (char *) &result;
-	int i;
-
-	result = issigned ? -1 : 0;
-
-	for (i = 0; i < size; i++) {
-		cresult[map[i]] = *data++;
-	}
-
-	return result;
-}
+/**
+ * Characters that are never escaped: alphanumerics (1) and, when the
+ * whitelist is enabled, the punctuation allowed by escapeJs/escapeHtmlAttr (2)
+ */
+static const unsigned char zephir_escape_map[128] = {
+	/* 0x00 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 2, 0, 0, 0, 0, 0,
+	/* 0x10 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	/*  !"# */ 2, 2, 0, 2, 2, 0, 0, 0, 2, 2, 2, 2, 2, 2, 2, 2,
+	/* 0-9  */ 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 2, 2, 0, 0, 0, 2,
+	/* @A-O */ 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+	/* P-Z  */ 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 2, 2, 2, 2, 2,
+	/* `a-o */ 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+	/* p-z  */ 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 2, 2, 2, 0, 0
+};
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+#if defined(__AVX2__)
+#include <immintrin.h>
+#endif
 
 /**
- * Converts an unsigned long to a char*
+ * Copies the longest prefix of UTF-32BE alphanumeric characters as single bytes.
+ * Returns the number of characters copied, always a multiple of the vector width
  */
-static inline char *zephir_longtohex(unsigned long value) {
+static zend_always_inline size_t zephir_escape_alnum_run(const unsigned char *src, size_t count, char *dst)
+{
+	size_t i = 0;
+
+#if defined(__AVX2__)
+	{
+		const __m256i high_mask = _mm256_set1_epi32(0x00FFFFFF);
+		const __m256i zero = _mm256_setzero_si256();
+		const __m256i digit_lo = _mm256_set1_epi32('0' - 1), digit_hi = _mm256_set1_epi32('9' + 1);
+		const __m256i upper_lo = _mm256_set1_epi32('A' - 1), upper_hi = _mm256_set1_epi32('Z' + 1);
+		const __m256i lower_lo = _mm256_set1_epi32('a' - 1), lower_hi = _mm256_set1_epi32('z' + 1);
+		__m256i v, ch, ok, packed;
+		int word;
+
+		for (; i + 8 <= count; i += 8) {
+
+			/* Every lane holds a big endian code point, its low byte ends up in the top byte */
+			v = _mm256_loadu_si256((const __m256i *) (src + (i << 2)));
+			ch = _mm256_srli_epi32(v, 24);
+
+			ok = _mm256_or_si256(
+				_mm256_and_si256(_mm256_cmpgt_epi32(ch, digit_lo), _mm256_cmpgt_epi32(digit_hi, ch)),
+				_mm256_or_si256(
+					_mm256_and_si256(_mm256_cmpgt_epi32(ch, upper_lo), _mm256_cmpgt_epi32(upper_hi, ch)),
+					_mm256_and_si256(_mm256_cmpgt_epi32(ch, lower_lo), _mm256_cmpgt_epi32(lower_hi, ch))
+				)
+			);
+			ok = _mm256_and_si256(ok, _mm256_cmpeq_epi32(_mm256_and_si256(v, high_mask), zero));
+			if (_mm256_movemask_epi8(ok) != -1) {
+				break;
+			}
 
-	static char digits[] = "0123456789abcdef";
-	char buf[(sizeof(unsigned long) << 3) + 1];
-	char *ptr, *end;
+			/* Narrow 32 bit lanes to bytes, the packs work on each 128 bit half */
+			packed = _mm256_packs_epi32(ch, ch);
+			packed = _mm256_packus_epi16(packed, packed);
+			word = _mm_cvtsi128_si32(_mm256_castsi256_si128(packed));
+			memcpy(dst + i, &word, 4);
+			word = _mm_cvtsi128_si32(_mm256_extracti128_si256(packed, 1));
+			memcpy(dst + i + 4, &word, 4);
+		}
+	}
+#endif
 
-	end = ptr = buf + sizeof(buf) - 1;
-	*ptr = '\0';
-	do {
-		*--ptr = digits[value & 0x0F];
-		value >>= 4;
-	} while (ptr > buf && value);
+#if defined(__SSE2__)
+	{
+		const __m128i high_mask = _mm_set1_epi32(0x00FFFFFF);
+		const __m128i zero = _mm_setzero_si128();
+		const __m128i digit_lo = _mm_set1_epi32('0' - 1), digit_hi = _mm_set1_epi32('9' + 1);
+		const __m128i upper_lo = _mm_set1_epi32('A' - 1), upper_hi = _mm_set1_epi32('Z' + 1);
+		const __m128i lower_lo = _mm_set1_epi32('a' - 1), lower_hi = _mm_set1_epi32('z' + 1);
+		__m128i v, ch, ok, packed;
+		int word;
+
+		for (; i + 4 <= count; i += 4) {
+
+			v = _mm_loadu_si128((const __m128i *) (src + (i << 2)));
+			ch = _mm_srli_epi32(v, 24);
+
+			ok = _mm_or_si128(
+				_mm_and_si128(_mm_cmpgt_epi32(ch, digit_lo), _mm_cmpgt_epi32(digit_hi, ch)),
+				_mm_or_si128(
+					_mm_and_si128(_mm_cmpgt_epi32(ch, upper_lo), _mm_cmpgt_epi32(upper_hi, ch)),
+					_mm_and_si128(_mm_cmpgt_epi32(ch, lower_lo), _mm_cmpgt_epi32(lower_hi, ch))
+				)
+			);
+			ok = _mm_and_si128(ok, _mm_cmpeq_epi32(_mm_and_si128(v, high_mask), zero));
+			if (_mm_movemask_epi8(ok) != 0xFFFF) {
+				break;
+			}
+
+			packed = _mm_packs_epi32(ch, ch);
+			packed = _mm_packus_epi16(packed, packed);
+			word = _mm_cvtsi128_si32(packed);
+			memcpy(dst + i, &word, 4);
+		}
+	}
+#endif
 
-	return estrndup(ptr, end - ptr);
+	return i;
 }
 
 /**
@@ -188,14 +261,15 @@ static inline char *zephir_longtohex(unsigned long value) {
  */
 void zephir_escape_multi(zval *return_value, zval *param, const char *escape_char, unsigned int escape_length, char escape_extra, int use_whitelist) {
 
-	unsigned int i;
+	static const char digits[] = "0123456789abcdef";
+	const unsigned char *src;
+	size_t i, count, run, newlen;
 	zval copy;
 	smart_str escaped_str = {0};
-	char machine_little_endian, *hex;
-	int big_endian_long_map[4];
-	int use_copy = 0, machine_endian_check = 1;
-	int issigned = 0;
-	long value;
+	char hex[8], *ptr;
+	int use_copy = 0;
+	unsigned int pass = use_whitelist ? 3 : 1;
+	unsigned long value;
 
 	if (Z_TYPE_P(param) != IS_STRING) {
 		zend_make_printable_zval(param, &copy, &use_copy);
@@ -205,113 +279,92 @@ void zephir_escape_multi(zval *return_value, zval *param, const char *escape_cha
 	}
 
 	if (Z_STRLEN_P(param) <= 0) {
+		if (use_copy) {
+			zval_dtor(param);
+		}
 		RETURN_FALSE;
 	}
 
-	/**
-	 * This is how the big_ending_long_map is calculated as in 'pack'
-	 */
-	machine_little_endian = ((char *) &machine_endian_check)[0];
-	if (machine_little_endian) {
-		big_endian_long_map[0] = 3;
-		big_endian_long_map[1] = 2;
-		big_endian_long_map[2] = 1;
-		big_endian_long_map[3] = 0;
-	} else {
-		int size = sizeof(Z_LVAL_P(param));
-		big_endian_long_map[0] = size - 4;
-		big_endian_long_map[1] = size - 3;
-		big_endian_long_map[2] = size - 2;
-		big_endian_long_map[3] = size - 1;
-	}
-
 	/**
 	 * The input must be a valid UTF-32 string
 	 */
 	if ((Z_STRLEN_P(param) % 4) != 0) {
+		if (use_copy) {
+			zval_dtor(param);
+		}
 		RETURN_FALSE;
 	}
 
-	for (i = 0; i < Z_STRLEN_P(param); i += 4) {
+	src = (const unsigned char *) Z_STRVAL_P(param);
+	count = Z_STRLEN_P(param) >> 2;
 
-		issigned = Z_STRVAL_P(param)[i] & 0x80;
+	/**
+	 * Every character produces at least one byte, reserve that up front
+	 */
+	smart_str_alloc(&escaped_str, count, 0);
 
-		value = 0;
-		if (sizeof(long) > 4 && issigned) {
-			value = ~INT_MAX;
-		}
+	for (i = 0; i < count; i++) {
 
-		value |= zephir_unpack(&Z_STRVAL_P(param)[i], 4, issigned, big_endian_long_map);
-		if (sizeof(long) > 4) {
-			value = (unsigned int) value;
+		/**
+		 * Copy whole vectors of alphanumeric characters at once
+		 */
+		if (count - i >= 4) {
+			smart_str_alloc(&escaped_str, count - i, 0);
+			run = zephir_escape_alnum_run(src + (i << 2), count - i, escaped_str.c + escaped_str.len);
+			if (run) {
+				escaped_str.len += run;
+				i += run;
+				if (i == count) {
+					break;
+				}
+			}
 		}
 
+		value = ((unsigned long) src[i << 2] << 24) | ((unsigned long) src[(i << 2) + 1] << 16) |
+			((unsigned long) src[(i << 2) + 2] << 8) | (unsigned long) src[(i << 2) + 3];
+
 		/**
 		 * CSS 2.1 section 4.1.3: "It is undefined in CSS 2.1 what happens if a
 		 * style sheet does contain a character with Unicode codepoint zero."
 		 */
-		if (value == '\0') {
+		if (value == 0) {
+			smart_str_free(&escaped_str);
+			if (use_copy) {
+				zval_dtor(param);
+			}
 			RETURN_FALSE;
 		}
 
 		/**
-		 * Alphanumeric characters are not escaped
+		 * Alphanumeric characters and the ones in the whitelist are left as they are
 		 */
-		if (value < 256 && isalnum(value)) {
+		if (value < 128) {
+			if (zephir_escape_map[value] & pass) {
+				smart_str_appendc(&escaped_str, (unsigned char) value);
+				continue;
+			}
+		} else if (value < 256 && isalnum((int) value)) {
 			smart_str_appendc(&escaped_str, (unsigned char) value);
 			continue;
 		}
 
 		/**
-		 * Chararters in the whitelist are left as they are
+		 * Convert character to hexadecimal, a code point never needs more than 8 digits
 		 */
-		if (use_whitelist) {
-			switch (value) {
-				case ' ':
-				case '/':
-				case '*':
-				case '+':
-				case '-':
-				case '\t':
-				case '\n':
-				case '^':
-				case '$':
-				case '!':
-				case '?':
-				case '\\':
-				case '#':
-				case '}':
-				case '{':
-				case ')':
-				case '(':
-				case ']':
-				case '[':
-				case '.':
-				case ',':
-				case ':':
-				case ';':
-				case '_':
-				case '|':
-					smart_str_appendc(&escaped_str, (unsigned char) value);
-					continue;
-			}
-		}
-
-		/**
-		 * Convert character to hexadecimal
-		 */
-		hex = zephir_longtohex(value);
+		ptr = hex + sizeof(hex);
+		do {
+			*--ptr = digits[value & 0x0F];
+			value >>= 4;
+		} while (value);
 
 		/**
 		 * Append the escaped character
 		 */
 		smart_str_appendl(&escaped_str, escape_char, escape_length);
-		smart_str_appendl(&escaped_str, hex, strlen(hex));
+		smart_str_appendl(&escaped_str, ptr, hex + sizeof(hex) - ptr);
 		if (escape_extra != '\0') {
 			smart_str_appendc(&escaped_str, escape_extra);
 		}
-
-		efree(hex);
 	}
 
 	if (use_copy) {
@@ -57,44 +57,82 @@ SOFTWARE.
 #define STATE_DECLARATION 5
 #define STATE_COMMENT 6
 
+/* Size of the blocks read from the source and written to the target when minifying streams */
+#define CSSMIN_CHUNK_SIZE 65536
+
 typedef struct _cssmin_parser {
 	int tmp_state;
 	int state;
-	int last_state;
 	int in_paren;
-	zval *style;
-	zval **error;
+	const unsigned char *pointer;
+	const unsigned char *end;
+	unsigned char *buffer;
+	php_stream *source;
+	php_stream *target;
 	smart_str *minified;
-	int style_pointer;
+	const char *error;
 } cssmin_parser;
 
-/* get -- return the next character from stdin. Watch out for lookahead. If
-the character is a control character, translate it to a space or
-linefeed.
+/* fill -- read the next block of the source stream
 */
 
-static char cssmin_peek(cssmin_parser *parser){
-	char ch;
-	if (parser->style_pointer < Z_STRLEN_P(parser->style)) {
-		ch = Z_STRVAL_P(parser->style)[parser->style_pointer];
-		return ch;
+static int cssmin_fill(cssmin_parser *parser) {
+
+	size_t length;
+
+	if (!parser->source) {
+		return 0;
 	}
-	return EOF;
+
+	length = php_stream_read(parser->source, (char *) parser->buffer, CSSMIN_CHUNK_SIZE);
+	if (length == 0 || length == (size_t) -1) {
+		return 0;
+	}
+
+	parser->pointer = parser->buffer;
+	parser->end = parser->buffer + length;
+	return 1;
 }
 
-static char cssmin_back_peek(cssmin_parser *parser){
-	char ch;
-	if (parser->style_pointer > 1) {
-		ch = Z_STRVAL_P(parser->style)[parser->style_pointer - 1];
-		return ch;
+/* flush -- write the minified content to the target stream
+*/
+
+static int cssmin_flush(cssmin_parser *parser) {
+
+	if (parser->target && parser->minified->len) {
+		if (php_stream_write(parser->target, parser->minified->c, parser->minified->len) != parser->minified->len) {
+			parser->error = "Minified content cannot be written.";
+			return FAILURE;
+		}
+		parser->minified->len = 0;
 	}
-	return EOF;
+
+	return SUCCESS;
+}
+
+/* get -- return the next character from the source. peek returns the character
+after it without moving the pointer.
+*/
+
+static inline int cssmin_peek(cssmin_parser *parser) {
+	if (parser->pointer == parser->end && !cssmin_fill(parser)) {
+		return EOF;
+	}
+	return *parser->pointer;
+}
+
+static inline int cssmin_get(cssmin_parser *parser) {
+	int c = cssmin_peek(parser);
+	if (c != EOF) {
+		parser->pointer++;
+	}
+	return c;
 }
 
 /* machine */
-static int phalcon_cssmin_machine(cssmin_parser *parser, unsigned char c TSRMLS_DC){
+static int phalcon_cssmin_machine(cssmin_parser *parser, int c) {
 
-	unsigned char p;
+	int p;
 
 	if (parser->state != STATE_COMMENT) {
 		if (c == '/' && cssmin_peek(parser) == '*') {
@@ -105,13 +143,10 @@ static int phalcon_cssmin_machine(cssmin_parser *parser, unsigned char c TSRMLS_
 
 	switch (parser->state) {
 		case STATE_FREE:
-			if (c == ' ' && c == '\t' && c == '\n' && c == '\r') {
-				c = 0;
-			} else if (c == '@'){
+			if (c == '@'){
 				parser->state = STATE_ATRULE;
 				break;
 			} else if(c > 0){
-				//fprintf(stdout,"one to 3 - %c %i",c,c);
 				parser->state = STATE_SELECTOR;
 			}
 			/* no break */
@@ -130,12 +165,7 @@ static int phalcon_cssmin_machine(cssmin_parser *parser, unsigned char c TSRMLS_
 							if (p == '{' || p == '\t' || p == ' ' || p == '>' || p == ',') {
 								c = 0;
 							} else {
-								p = cssmin_back_peek(parser);
-								if (p == ',' || p == '>' || p == ':') {
-									c = 0;
-								} else {
-									c = ' ';
-								}
+								c = ' ';
 							}
 						}
 					}
@@ -163,7 +193,6 @@ static int phalcon_cssmin_machine(cssmin_parser *parser, unsigned char c TSRMLS_
 			} else {
 				if (c == '}') {
 					parser->state = STATE_FREE;
-					//fprintf(stdout,"closing bracket found in block\n");
 					break;
 				} else {
 					parser->state = STATE_DECLARATION;
@@ -221,7 +250,7 @@ static int phalcon_cssmin_machine(cssmin_parser *parser, unsigned char c TSRMLS_
 			break;
 		case STATE_COMMENT:
 			if (c == '*' && cssmin_peek(parser) == '/'){
-				parser->style_pointer += 2;
+				parser->pointer++;
 				parser->state = parser->tmp_state;
 			}
 			c = 0;
@@ -231,39 +260,76 @@ static int phalcon_cssmin_machine(cssmin_parser *parser, unsigned char c TSRMLS_
 	return c;
 }
 
-int phalcon_cssmin_internal(zval *return_value, zval *style, zval **error TSRMLS_DC) {
+/* run -- pass every character through the machine. Runs of characters the machine
+would copy unchanged in the current state are copied at once and comments are
+skipped scanning for their end.
+*/
 
-	int i;
-	unsigned char c;
-	cssmin_parser parser;
-	smart_str minified = {0};
+static int cssmin_run(cssmin_parser *parser) {
 
-	parser.tmp_state = 0;
-	parser.state = 1;
-	parser.last_state = 1;
-	parser.in_paren = 0;
-	parser.style = style;
-	parser.error = error;
-	parser.minified = &minified;
+	int c;
+	const unsigned char *p;
+
+	parser->tmp_state = 0;
+	parser->state = STATE_FREE;
+	parser->in_paren = 0;
+	parser->error = NULL;
+
+	while ((c = cssmin_get(parser)) != EOF) {
+
+		if (parser->target && parser->minified->len >= CSSMIN_CHUNK_SIZE) {
+			if (cssmin_flush(parser) == FAILURE) {
+				return FAILURE;
+			}
+		}
 
-	for (i = 0; i < Z_STRLEN_P(style); i++) {
-		parser.style_pointer = i + 1;
-		c = phalcon_cssmin_machine(&parser, Z_STRVAL_P(style)[i] TSRMLS_CC);
+		c = phalcon_cssmin_machine(parser, c);
 		if (c != 0) {
-			smart_str_appendc(parser.minified, c);
+			smart_str_appendc(parser->minified, c);
 		}
-		i = parser.style_pointer - 1;
-	}
 
-	smart_str_0(&minified);
+		p = parser->pointer;
+		switch (parser->state) {
 
-	if (minified.len) {
-		ZVAL_STRINGL(return_value, minified.c, minified.len, 0);
-	} else {
-		ZVAL_STRING(return_value, "", 1);
+			case STATE_SELECTOR:
+				while (p < parser->end && *p > ' ' && *p != '{' && *p != '@' && *p != '/') {
+					p++;
+				}
+				break;
+
+			case STATE_ATRULE:
+				while (p < parser->end && *p != '\0' && *p != '\n' && *p != '\r' && *p != ';' && *p != '{' && *p != '/') {
+					p++;
+				}
+				break;
+
+			case STATE_DECLARATION:
+				if (parser->in_paren) {
+					while (p < parser->end && *p != '\0' && *p != ')' && *p != '/') {
+						p++;
+					}
+				} else {
+					while (p < parser->end && *p > ' ' && *p != '(' && *p != ';' && *p != '}' && *p != '/') {
+						p++;
+					}
+				}
+				break;
+
+			case STATE_COMMENT:
+				while (p < parser->end && *p != '*') {
+					p++;
+				}
+				parser->pointer = p;
+				continue;
+		}
+
+		if (p > parser->pointer) {
+			smart_str_appendl(parser->minified, (const char *) parser->pointer, p - parser->pointer);
+			parser->pointer = p;
+		}
 	}
 
-	return SUCCESS;
+	return cssmin_flush(parser);
 }
 
 /* cssmin -- minify the css
@@ -274,7 +340,9 @@ int phalcon_cssmin_internal(zval *return_value, zval *style, zval **error TSRMLS
 
 int phalcon_cssmin(zval *return_value, zval *style TSRMLS_DC) {
 
-	zval *error = NULL;
+	cssmin_parser parser;
+	smart_str minified = {0};
+	size_t newlen;
 
 	ZEPHIR_MM_GROW();
 
@@ -285,15 +353,90 @@ int phalcon_cssmin(zval *return_value, zval *style TSRMLS_DC) {
 		return FAILURE;
 	}
 
-	if (phalcon_cssmin_internal(return_value, style, &error TSRMLS_CC) == FAILURE) {
-		if (Z_TYPE_P(error) == IS_STRING) {
-			ZEPHIR_THROW_EXCEPTION_STR(phalcon_assets_exception_ce, Z_STRVAL_P(error));
-		} else {
-			ZEPHIR_THROW_EXCEPTION_STR(phalcon_assets_exception_ce, "Unknown error");
-		}
+	/**
+	 * The minified style is never larger than the original one
+	 */
+	smart_str_alloc(&minified, (size_t) Z_STRLEN_P(style), 0);
+
+	parser.pointer = (const unsigned char *) Z_STRVAL_P(style);
+	parser.end = parser.pointer + Z_STRLEN_P(style);
+	parser.buffer = NULL;
+	parser.source = NULL;
+	parser.target = NULL;
+	parser.minified = &minified;
+
+	cssmin_run(&parser);
+
+	smart_str_0(&minified);
+
+	if (minified.len) {
+		ZVAL_STRINGL(return_value, minified.c, minified.len, 0);
+	} else {
+		smart_str_free(&minified);
+		ZVAL_STRING(return_value, "", 1);
+	}
+
+	ZEPHIR_MM_RESTORE();
+	return SUCCESS;
+}
+
+/* cssmin_file -- minify a file into another one reading and writing blocks, the
+	whole content of the files is never kept in memory
+*/
+
+int phalcon_cssmin_file(zval *return_value, zval *source_path, zval *target_path TSRMLS_DC) {
+
+	cssmin_parser parser;
+	smart_str minified = {0};
+	php_stream *source, *target;
+	size_t newlen;
+	int status;
+
+	ZEPHIR_MM_GROW();
+
+	ZVAL_NULL(return_value);
+
+	if (Z_TYPE_P(source_path) != IS_STRING || Z_TYPE_P(target_path) != IS_STRING) {
+		ZEPHIR_THROW_EXCEPTION_STR(phalcon_assets_exception_ce, "Source and target paths must be strings");
+		return FAILURE;
+	}
+
+	source = php_stream_open_wrapper(Z_STRVAL_P(source_path), "rb", REPORT_ERRORS, NULL);
+	if (!source) {
+		ZEPHIR_THROW_EXCEPTION_STR(phalcon_assets_exception_ce, "Source file cannot be read");
 		return FAILURE;
 	}
 
+	target = php_stream_open_wrapper(Z_STRVAL_P(target_path), "wb", REPORT_ERRORS, NULL);
+	if (!target) {
+		php_stream_close(source);
+		ZEPHIR_THROW_EXCEPTION_STR(phalcon_assets_exception_ce, "Target file cannot be written");
+		return FAILURE;
+	}
+
+	smart_str_alloc(&minified, CSSMIN_CHUNK_SIZE * 2, 0);
+
+	parser.buffer = emalloc(CSSMIN_CHUNK_SIZE);
+	parser.pointer = parser.buffer;
+	parser.end = parser.buffer;
+	parser.source = source;
+	parser.target = target;
+	parser.minified = &minified;
+
+	status = cssmin_run(&parser);
+
+	efree(parser.buffer);
+	smart_str_free(&minified);
+	php_stream_close(source);
+	php_stream_close(target);
+
+	if (status == FAILURE) {
+		ZEPHIR_THROW_EXCEPTION_STR(phalcon_assets_exception_ce, parser.error ? parser.error : "Unknown error");
+		return FAILURE;
+	}
+
+	ZVAL_TRUE(return_value);
+
 	ZEPHIR_MM_RESTORE();
 	return SUCCESS;
 }
@@ -30,5 +30,6 @@ SOFTWARE.
 #include <Zend/zend.h>
 
 int phalcon_cssmin(zval *return_value, zval *style TSRMLS_DC);
+int phalcon_cssmin_file(zval *return_value, zval *source_path, zval *target_path TSRMLS_DC);
 
 #endif /* PHALCON_ASSETS_FILTERS_CSSMINIFIER_H */
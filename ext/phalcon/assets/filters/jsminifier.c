@@ -42,68 +42,115 @@ SOFTWARE.
 #define JSMIN_ACTION_NEXT_DELETE 2
 #define JSMIN_ACTION_NEXT 3
 
+/* Size of the blocks read from the source and written to the target when minifying streams */
+#define JSMIN_CHUNK_SIZE 65536
+
 typedef struct _jsmin_parser {
-	zval *script;
-	zval **error;
-	int script_pointer;
-	int inside_string;
+	const unsigned char *pointer;
+	const unsigned char *end;
+	unsigned char *buffer;
+	php_stream *source;
+	php_stream *target;
 	smart_str *minified;
-	char theA;
-	char theB;
-	char theC;
-	char theX;
-	char theY;
+	const char *error;
+	int inside_string;
+	int theA;
+	int theB;
+	int theX;
+	int theY;
 } jsmin_parser;
 
-static void jsmin_error(jsmin_parser *parser, char* s, int s_length TSRMLS_DC) {
-	ZEPHIR_INIT_VAR(*parser->error);
-	ZVAL_STRINGL(*parser->error, s, s_length, 1);
+static void jsmin_error(jsmin_parser *parser, const char *s) {
+	if (!parser->error) {
+		parser->error = s;
+	}
 }
 
 /* isAlphanum -- return true if the character is a letter, digit, underscore,
 		dollar sign, or non-ASCII character.
 */
 
-static int jsmin_isAlphanum(int c) {
+static inline int jsmin_isAlphanum(int c) {
 	return ((c >= 'a' && c <= 'z') || (c >= '0' && c <= '9') || (c >= 'A' && c <= 'Z') || c == '_' || c == '$' || c == '\\' || c > 126);
 }
 
+/* isPlain -- return true if the character is copied as is when it is found between
+		other plain characters: it is not a space, a control character, a quote or
+		a slash starting a comment or a regular expression.
+*/
+
+static inline int jsmin_isPlain(int c) {
+	return (c > ' ' && c != '/' && c != '\'' && c != '"' && c != '`');
+}
+
+/* fill -- read the next block of the source stream. The last character of the
+		previous block is kept before the new one so the scanner can always look
+		at the character preceding the pointer.
+*/
+
+static int jsmin_fill(jsmin_parser *parser) {
+
+	size_t length;
+
+	if (!parser->source) {
+		return 0;
+	}
+
+	parser->buffer[0] = parser->end[-1];
+
+	length = php_stream_read(parser->source, (char *) parser->buffer + 1, JSMIN_CHUNK_SIZE);
+	if (length == 0 || length == (size_t) -1) {
+		return 0;
+	}
 
-/* get -- return the next character from stdin. Watch out for lookahead. If
+	parser->pointer = parser->buffer + 1;
+	parser->end = parser->buffer + 1 + length;
+	return 1;
+}
+
+/* flush -- write the minified content to the target stream
+*/
+
+static int jsmin_flush(jsmin_parser *parser) {
+
+	if (parser->target && parser->minified->len) {
+		if (php_stream_write(parser->target, parser->minified->c, parser->minified->len) != parser->minified->len) {
+			jsmin_error(parser, "Minified content cannot be written.");
+			return FAILURE;
+		}
+		parser->minified->len = 0;
+	}
+
+	return SUCCESS;
+}
+
+/* get -- return the next character from the source. Watch out for lookahead. If
 		the character is a control character, translate it to a space or
 		linefeed.
 */
 
-static char jsmin_peek(jsmin_parser *parser){
-	char ch;
-	if (parser->script_pointer < Z_STRLEN_P(parser->script)) {
-		ch = Z_STRVAL_P(parser->script)[parser->script_pointer];
-		return ch;
+static inline int jsmin_peek(jsmin_parser *parser) {
+	if (parser->pointer == parser->end && !jsmin_fill(parser)) {
+		return EOF;
 	}
-	return EOF;
+	return *parser->pointer;
 }
 
-static char jsmin_get(jsmin_parser *parser) {
+static int jsmin_get(jsmin_parser *parser) {
 
-	char c;
+	int c = jsmin_peek(parser);
 
-	if (parser->script_pointer < Z_STRLEN_P(parser->script)) {
-		c = Z_STRVAL_P(parser->script)[parser->script_pointer];
-		parser->script_pointer++;
-	} else {
-		c = EOF;
+	if (c == EOF) {
+		return EOF;
 	}
 
-	parser->theC = c;
+	parser->pointer++;
 
-	if (parser->inside_string == 1) {
-		if (c >= ' ' || c == '\n' || c == '\t' || c == EOF) {
-			return c;
-		}
-	} else {
-		if (c >= ' ' || c == '\n' || c == EOF) {
-			return c;
-		}
+	if (c >= ' ' || c == '\n') {
+		return c;
+	}
+	if (c == '\t' && parser->inside_string) {
+		return c;
 	}
 	if (c == '\r') {
 		return '\n';
@@ -113,37 +160,53 @@ static char jsmin_get(jsmin_parser *parser) {
 
 
 /* next -- get the next character, excluding comments. peek() is used to see
-		if a '/' is followed by a '/' or '*'.
+		if a '/' is followed by a '/' or '*'. Comments are skipped scanning the
+		buffer for the characters that end them.
 */
 
-static int jsmin_next(jsmin_parser *parser TSRMLS_DC) {
-	char c = jsmin_get(parser);
-	if  (c == '/') {
+static int jsmin_next(jsmin_parser *parser) {
+
+	const unsigned char *p;
+	int c = jsmin_get(parser);
+
+	if (c == '/') {
 		switch (jsmin_peek(parser)) {
 			case '/':
 				for (;;) {
-					c = jsmin_get(parser);
-					if (c <= '\n') {
+					p = parser->pointer;
+					while (p < parser->end && *p != '\n' && *p != '\r') {
+						p++;
+					}
+					parser->pointer = p;
+					if (p < parser->end || !jsmin_fill(parser)) {
 						break;
 					}
 				}
+				c = jsmin_get(parser);
 				break;
-		case '*':
-			jsmin_get(parser);
-			while (c != ' ') {
-				switch (jsmin_get(parser)) {
-					case '*':
-						if (jsmin_peek(parser) == '/') {
-							jsmin_get(parser);
-							c = ' ';
+			case '*':
+				parser->pointer++;
+				for (;;) {
+					p = parser->pointer;
+					while (p < parser->end && *p != '*') {
+						p++;
+					}
+					parser->pointer = p;
+					if (p == parser->end) {
+						if (!jsmin_fill(parser)) {
+							jsmin_error(parser, "Unterminated comment.");
+							return EOF;
 						}
+						continue;
+					}
+					parser->pointer++;
+					if (jsmin_peek(parser) == '/') {
+						parser->pointer++;
+						c = ' ';
 						break;
-					case EOF:
-						jsmin_error(parser, SL("Unterminated comment.") TSRMLS_CC);
-						return FAILURE;
+					}
 				}
-			}
-			break;
+				break;
 		}
 	}
 	parser->theY = parser->theX;
@@ -159,7 +222,10 @@ static int jsmin_next(jsmin_parser *parser TSRMLS_DC) {
    action recognizes a regular expression if it is preceded by ( or , or =.
 */
 
-static int jsmin_action(jsmin_parser *parser, char d TSRMLS_DC) {
+static int jsmin_action(jsmin_parser *parser, int d) {
+
+	const unsigned char *p;
+
 	switch (d) {
 		case JSMIN_ACTION_OUTPUT_NEXT:
 			smart_str_appendc(parser->minified, parser->theA);
@@ -177,6 +243,17 @@ static int jsmin_action(jsmin_parser *parser, char d TSRMLS_DC) {
 				parser->inside_string = 1;
 				for (;;) {
 					smart_str_appendc(parser->minified, parser->theA);
+					/**
+					 * Copy at once the run of characters that don't end the literal
+					 */
+					p = parser->pointer;
+					while (p < parser->end && (*p >= ' ' || *p == '\n' || *p == '\t') && *p != parser->theB && *p != '\\') {
+						p++;
+					}
+					if (p > parser->pointer) {
+						smart_str_appendl(parser->minified, (const char *) parser->pointer, p - parser->pointer);
+						parser->pointer = p;
+					}
 					parser->theA = jsmin_get(parser);
 					if (parser->theA == parser->theB) {
 						break;
@@ -186,7 +263,7 @@ static int jsmin_action(jsmin_parser *parser, char d TSRMLS_DC) {
 						parser->theA = jsmin_get(parser);
 					}
 					if (parser->theA == EOF) {
-						jsmin_error(parser, SL("Unterminated string literal.") TSRMLS_CC);
+						jsmin_error(parser, "Unterminated string literal.");
 						return FAILURE;
 					}
 				}
@@ -194,8 +271,8 @@ static int jsmin_action(jsmin_parser *parser, char d TSRMLS_DC) {
 			}
 			/* no break */
 		case JSMIN_ACTION_NEXT:
-			parser->theB = jsmin_next(parser TSRMLS_CC);
-			if (*parser->error != NULL) {
+			parser->theB = jsmin_next(parser);
+			if (parser->error) {
 				return FAILURE;
 			}
 			if (parser->theB == '/' && (
@@ -223,7 +300,7 @@ static int jsmin_action(jsmin_parser *parser, char d TSRMLS_DC) {
 								parser->theA = jsmin_get(parser);
 							}
 							if (parser->theA == EOF) {
-								jsmin_error(parser, SL("Unterminated set in Regular Expression literal.") TSRMLS_CC);
+								jsmin_error(parser, "Unterminated set in Regular Expression literal.");
 								return FAILURE;
 							}
 						}
@@ -232,7 +309,7 @@ static int jsmin_action(jsmin_parser *parser, char d TSRMLS_DC) {
 							switch (jsmin_peek(parser)) {
 								case '/':
 								case '*':
-									jsmin_error(parser, SL("Unterminated set in Regular Expression literal.") TSRMLS_CC);
+									jsmin_error(parser, "Unterminated set in Regular Expression literal.");
 									return FAILURE;
 							}
 							break;
@@ -244,13 +321,13 @@ static int jsmin_action(jsmin_parser *parser, char d TSRMLS_DC) {
 						}
 					}
 					if (parser->theA == EOF) {
-						jsmin_error(parser, SL("Unterminated Regular Expression literal.") TSRMLS_CC);
+						jsmin_error(parser, "Unterminated Regular Expression literal.");
 						return FAILURE;
 					}
 					smart_str_appendc(parser->minified, parser->theA);
 				}
-				parser->theB = jsmin_next(parser TSRMLS_CC);
-				if (*parser->error != NULL) {
+				parser->theB = jsmin_next(parser);
+				if (parser->error) {
 					return FAILURE;
 				}
 			}
@@ -266,38 +343,71 @@ static int jsmin_action(jsmin_parser *parser, char d TSRMLS_DC) {
 		Most spaces and linefeeds will be removed.
 */
 
-int phalcon_jsmin_internal(zval *return_value, zval *script, zval **error TSRMLS_DC) {
+static int jsmin_run(jsmin_parser *parser) {
 
-	jsmin_parser parser;
-	smart_str minified = {0};
-	int status = SUCCESS;
-
-	parser.theA = '\n';
-	parser.theX = EOF;
-	parser.theY = EOF;
-	parser.script = script;
-	parser.error = error;
-	parser.script_pointer = 0;
-	parser.inside_string = 0;
-	parser.minified = &minified;
+	const unsigned char *p;
+	int action;
+
+	parser->theA = '\n';
+	parser->theX = EOF;
+	parser->theY = EOF;
+	parser->inside_string = 0;
+	parser->error = NULL;
 
-	if (jsmin_action(&parser, JSMIN_ACTION_NEXT TSRMLS_CC) == FAILURE) {
+	if (jsmin_action(parser, JSMIN_ACTION_NEXT) == FAILURE) {
 		return FAILURE;
 	}
 
-	while (parser.theA != EOF) {
-		if (status == FAILURE) {
-			break;
+	while (parser->theA != EOF) {
+
+		if (parser->target && parser->minified->len >= JSMIN_CHUNK_SIZE) {
+			if (jsmin_flush(parser) == FAILURE) {
+				return FAILURE;
+			}
+		}
+
+		/**
+		 * Spaces following a space in B are deleted by every action
+		 */
+		if (parser->theB == ' ') {
+			p = parser->pointer;
+			while (p < parser->end && (*p == ' ' || (*p < ' ' && *p != '\n' && *p != '\r'))) {
+				p++;
+			}
+			if (p > parser->pointer) {
+				parser->pointer = p;
+				parser->theY = ' ';
+				parser->theX = ' ';
+			}
+		}
+
+		/**
+		 * Between plain characters every action just outputs A, so the whole run
+		 * is copied at once. B is always the character before the pointer here
+		 */
+		if (jsmin_isPlain(parser->theA) && jsmin_isPlain(parser->theB) && parser->theY != ' ' && parser->theY != '\n') {
+			p = parser->pointer;
+			while (p < parser->end && jsmin_isPlain(*p)) {
+				p++;
+			}
+			if (p > parser->pointer) {
+				smart_str_appendc(parser->minified, parser->theA);
+				smart_str_appendl(parser->minified, (const char *) parser->pointer - 1, p - parser->pointer - 1);
+				parser->theA = p[-2];
+				parser->theB = p[-1];
+				parser->theY = parser->theA;
+				parser->theX = parser->theB;
+				parser->pointer = p;
+				continue;
+			}
 		}
-		switch (parser.theA) {
+
+		switch (parser->theA) {
 			case ' ':
-				if (jsmin_action(&parser, jsmin_isAlphanum(parser.theB) ? JSMIN_ACTION_OUTPUT_NEXT : JSMIN_ACTION_NEXT_DELETE TSRMLS_CC)) {
-					status = FAILURE;
-					break;
-				}
+				action = jsmin_isAlphanum(parser->theB) ? JSMIN_ACTION_OUTPUT_NEXT : JSMIN_ACTION_NEXT_DELETE;
 				break;
 			case '\n':
-				switch (parser.theB) {
+				switch (parser->theB) {
 					case '{':
 					case '[':
 					case '(':
@@ -305,34 +415,22 @@ int phalcon_jsmin_internal(zval *return_value, zval *script, zval **error TSRMLS
 					case '-':
 					case '!':
 					case '~':
-						if (jsmin_action(&parser, JSMIN_ACTION_OUTPUT_NEXT TSRMLS_CC) == FAILURE) {
-							status = FAILURE;
-							break;
-						}
+						action = JSMIN_ACTION_OUTPUT_NEXT;
 						break;
 					case ' ':
-						if (jsmin_action(&parser, JSMIN_ACTION_NEXT TSRMLS_CC) == FAILURE) {
-							status = FAILURE;
-							break;
-						}
+						action = JSMIN_ACTION_NEXT;
 						break;
 					default:
-						if (jsmin_action(&parser, jsmin_isAlphanum(parser.theB) ? JSMIN_ACTION_OUTPUT_NEXT : JSMIN_ACTION_NEXT_DELETE TSRMLS_CC) == FAILURE) {
-							status = FAILURE;
-							break;
-						}
+						action = jsmin_isAlphanum(parser->theB) ? JSMIN_ACTION_OUTPUT_NEXT : JSMIN_ACTION_NEXT_DELETE;
 				}
 				break;
 			default:
-				switch (parser.theB) {
+				switch (parser->theB) {
 					case ' ':
-						if (jsmin_action(&parser, jsmin_isAlphanum(parser.theA) ? JSMIN_ACTION_OUTPUT_NEXT : JSMIN_ACTION_NEXT TSRMLS_CC) == FAILURE) {
-							status = FAILURE;
-							break;
-						}
+						action = jsmin_isAlphanum(parser->theA) ? JSMIN_ACTION_OUTPUT_NEXT : JSMIN_ACTION_NEXT;
 						break;
 					case '\n':
-						switch (parser.theA) {
+						switch (parser->theA) {
 							case '}':
 							case ']':
 							case ')':
@@ -341,30 +439,55 @@ int phalcon_jsmin_internal(zval *return_value, zval *script, zval **error TSRMLS
 							case '"':
 							case '\'':
 							case '`':
-								if (jsmin_action(&parser, JSMIN_ACTION_OUTPUT_NEXT TSRMLS_CC) == FAILURE) {
-									status = FAILURE;
-									break;
-								}
+								action = JSMIN_ACTION_OUTPUT_NEXT;
 								break;
 							default:
-								if (jsmin_action(&parser, jsmin_isAlphanum(parser.theA) ? JSMIN_ACTION_OUTPUT_NEXT : JSMIN_ACTION_NEXT TSRMLS_CC) == FAILURE) {
-									status = FAILURE;
-									break;
-								}
-							}
-							break;
-					default:
-						if (jsmin_action(&parser, JSMIN_ACTION_OUTPUT_NEXT TSRMLS_CC) == FAILURE) {
-							status = FAILURE;
-							break;
+								action = jsmin_isAlphanum(parser->theA) ? JSMIN_ACTION_OUTPUT_NEXT : JSMIN_ACTION_NEXT;
 						}
 						break;
+					default:
+						action = JSMIN_ACTION_OUTPUT_NEXT;
 				}
 		}
+
+		if (jsmin_action(parser, action) == FAILURE) {
+			return FAILURE;
+		}
 	}
 
-	if (status == FAILURE) {
+	return jsmin_flush(parser);
+}
+
+int phalcon_jsmin(zval *return_value, zval *script TSRMLS_DC) {
+
+	jsmin_parser parser;
+	smart_str minified = {0};
+	size_t newlen;
+
+	ZEPHIR_MM_GROW();
+
+	ZVAL_NULL(return_value);
+
+	if (Z_TYPE_P(script) != IS_STRING) {
+		ZEPHIR_THROW_EXCEPTION_STR(phalcon_assets_exception_ce, "Script must be a string");
+		return FAILURE;
+	}
+
+	/**
+	 * The minified script is never larger than the original one plus the leading linefeed
+	 */
+	smart_str_alloc(&minified, (size_t) Z_STRLEN_P(script) + 1, 0);
+
+	parser.pointer = (const unsigned char *) Z_STRVAL_P(script);
+	parser.end = parser.pointer + Z_STRLEN_P(script);
+	parser.buffer = NULL;
+	parser.source = NULL;
+	parser.target = NULL;
+	parser.minified = &minified;
+
+	if (jsmin_run(&parser) == FAILURE) {
 		smart_str_free(&minified);
+		ZEPHIR_THROW_EXCEPTION_STR(phalcon_assets_exception_ce, parser.error ? parser.error : "Unknown error");
 		return FAILURE;
 	}
 
@@ -373,34 +496,72 @@ int phalcon_jsmin_internal(zval *return_value, zval *script, zval **error TSRMLS
 	if (minified.len) {
 		ZVAL_STRINGL(return_value, minified.c, minified.len, 0);
 	} else {
+		smart_str_free(&minified);
 		ZVAL_STRING(return_value, "", 1);
 	}
 
+	ZEPHIR_MM_RESTORE();
 	return SUCCESS;
 }
 
-int phalcon_jsmin(zval *return_value, zval *script TSRMLS_DC) {
+/* jsmin_file -- minify a file into another one reading and writing blocks, the
+		whole content of the files is never kept in memory
+*/
 
-	zval *error = NULL;
+int phalcon_jsmin_file(zval *return_value, zval *source_path, zval *target_path TSRMLS_DC) {
+
+	jsmin_parser parser;
+	smart_str minified = {0};
+	php_stream *source, *target;
+	size_t newlen;
+	int status;
 
 	ZEPHIR_MM_GROW();
 
 	ZVAL_NULL(return_value);
 
-	if (Z_TYPE_P(script) != IS_STRING) {
-		ZEPHIR_THROW_EXCEPTION_STR(phalcon_assets_exception_ce, "Script must be a string");
+	if (Z_TYPE_P(source_path) != IS_STRING || Z_TYPE_P(target_path) != IS_STRING) {
+		ZEPHIR_THROW_EXCEPTION_STR(phalcon_assets_exception_ce, "Source and target paths must be strings");
 		return FAILURE;
 	}
 
-	if (phalcon_jsmin_internal(return_value, script, &error TSRMLS_CC) == FAILURE){
-		if (Z_TYPE_P(error) == IS_STRING) {
-			ZEPHIR_THROW_EXCEPTION_STR(phalcon_assets_exception_ce, Z_STRVAL_P(error));
-		} else {
-			ZEPHIR_THROW_EXCEPTION_STR(phalcon_assets_exception_ce, "Unknown error");
-		}
+	source = php_stream_open_wrapper(Z_STRVAL_P(source_path), "rb", REPORT_ERRORS, NULL);
+	if (!source) {
+		ZEPHIR_THROW_EXCEPTION_STR(phalcon_assets_exception_ce, "Source file cannot be read");
+		return FAILURE;
+	}
+
+	target = php_stream_open_wrapper(Z_STRVAL_P(target_path), "wb", REPORT_ERRORS, NULL);
+	if (!target) {
+		php_stream_close(source);
+		ZEPHIR_THROW_EXCEPTION_STR(phalcon_assets_exception_ce, "Target file cannot be written");
 		return FAILURE;
 	}
 
+	smart_str_alloc(&minified, JSMIN_CHUNK_SIZE * 2, 0);
+
+	parser.buffer = emalloc(JSMIN_CHUNK_SIZE + 1);
+	parser.buffer[0] = '\n';
+	parser.pointer = parser.buffer + 1;
+	parser.end = parser.buffer + 1;
+	parser.source = source;
+	parser.target = target;
+	parser.minified = &minified;
+
+	status = jsmin_run(&parser);
+
+	efree(parser.buffer);
+	smart_str_free(&minified);
+	php_stream_close(source);
+	php_stream_close(target);
+
+	if (status == FAILURE) {
+		ZEPHIR_THROW_EXCEPTION_STR(phalcon_assets_exception_ce, parser.error ? parser.error : "Unknown error");
+		return FAILURE;
+	}
+
+	ZVAL_TRUE(return_value);
+
 	ZEPHIR_MM_RESTORE();
 	return SUCCESS;
 }
@@ -30,5 +30,6 @@ SOFTWARE.
 #include <Zend/zend.h>
 
 int phalcon_jsmin(zval *return_value, zval *script TSRMLS_DC);
+int phalcon_jsmin_file(zval *return_value, zval *source_path, zval *target_path TSRMLS_DC);
 
 #endif /* PHALCON_ASSETS_FILTERS_JSMINIFIER_H */
@@ -96,6 +96,14 @@ abstract class Adapter
 		 * Try to read the annotations from the adapter
 		 */
 		let classAnnotations = this->{"read"}(realClassName);
+
+		/**
+		 * Avoid reading the adapter again for the same class
+		 */
+		if typeof classAnnotations == "object" {
+			let this->_annotations[realClassName] = classAnnotations;
+		}
+
 		if classAnnotations === null || classAnnotations === false {
 
 			/**
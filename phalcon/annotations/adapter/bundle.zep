@@ -0,0 +1,271 @@
+
+/*
+ +------------------------------------------------------------------------+
+ | Phalcon Framework                                                      |
+ +------------------------------------------------------------------------+
+ | Copyright (c) 2011-2015 Phalcon Team (http://www.phalconphp.com)       |
+ +------------------------------------------------------------------------+
+ | This source file is subject to the New BSD License that is bundled     |
+ | with this package in the file docs/LICENSE.txt.                        |
+ |                                                                        |
+ | If you did not receive a copy of the license and are unable to         |
+ | obtain it through the world-wide-web, please send an email             |
+ | to license@phalconphp.com so we can send you a copy immediately.       |
+ +------------------------------------------------------------------------+
+ | Authors: Andres Gutierrez <andres@phalconphp.com>                      |
+ |          Eduar Carvajal <eduar@phalconphp.com>                         |
+ +------------------------------------------------------------------------+
+ */
+
+namespace Phalcon\Annotations\Adapter;
+
+use Phalcon\Annotations\Adapter;
+use Phalcon\Annotations\AdapterInterface;
+use Phalcon\Annotations\Reflection;
+use Phalcon\Annotations\Exception;
+
+/**
+ * Phalcon\Annotations\Adapter\Bundle
+ *
+ * Stores the parsed annotations of a whole code base in a single file. The file is loaded once
+ * per process and, being a plain PHP file, kept in the shared memory of the opcode cache.
+ * The bundle is only written by warm(), which is meant to run at deploy time; classes missing
+ * from it are parsed and kept in memory for the rest of the process but are not persisted.
+ * Every entry carries a hash of the contents of the file that declares the class, the class
+ * is parsed again when its file changes no matter its modification time. Each file is hashed
+ * at most once per process, pass 'validate' => false to skip the check entirely.
+ * This adapter is suitable for production
+ *
+ *<code>
+ * $annotations = new \Phalcon\Annotations\Adapter\Bundle(array(
+ *    'bundleFile' => 'app/cache/annotations.php'
+ * ));
+ *
+ * // At build time
+ * $annotations->warm(array(
+ *    'Store\Controllers\ProductsController',
+ *    'Store\Controllers\CustomersController'
+ * ));
+ *</code>
+ */
+class Bundle extends Adapter implements AdapterInterface
+{
+	protected _bundleFile = "./annotations.php";
+
+	protected _validate = true;
+
+	protected _entries;
+
+	protected static _bundles;
+
+	protected static _fileHashes;
+
+	/**
+	 * Phalcon\Annotations\Adapter\Bundle constructor
+	 *
+	 * @param array options
+	 */
+	public function __construct(options = null)
+	{
+		var bundleFile, validate;
+
+		if typeof options == "array" {
+			if fetch bundleFile, options["bundleFile"] {
+				let this->_bundleFile = bundleFile;
+			}
+			if fetch validate, options["validate"] {
+				let this->_validate = (boolean) validate;
+			}
+		}
+	}
+
+	/**
+	 * Reads parsed annotations from the bundle
+	 *
+	 * @param string key
+	 * @return Phalcon\Annotations\Reflection
+	 */
+	public function read(string! key) -> <Reflection> | boolean
+	{
+		var entries, entry;
+
+		let entries = this->_getEntries();
+		if !fetch entry, entries[key] {
+			return false;
+		}
+
+		/**
+		 * The file declaring the class is hashed once per process
+		 */
+		if this->_validate {
+			if this->_getFileHash(entry[0]) !== entry[1] {
+				return false;
+			}
+		}
+
+		return entry[2];
+	}
+
+	/**
+	 * Stores parsed annotations in the bundle of the process, they are written to
+	 * the bundle file only by warm()
+	 *
+	 * @param string key
+	 * @param Phalcon\Annotations\Reflection data
+	 */
+	public function write(string! key, <Reflection> data)
+	{
+		var reflection, path, entries;
+
+		let reflection = new \ReflectionClass(key),
+			path = reflection->getFileName();
+
+		if typeof path != "string" {
+			let path = "";
+		}
+
+		let entries = this->_getEntries(),
+			entries[key] = [path, this->_hashFile(path), data];
+
+		let this->_entries = entries,
+			self::_bundles[this->_bundleFile] = entries;
+	}
+
+	/**
+	 * Parses the annotations of the passed classes and replaces the bundle with them,
+	 * the file is written once. Returns the number of classes stored
+	 *
+	 * @param array classes
+	 * @return int
+	 */
+	public function warm(array! classes) -> int
+	{
+		var reader, className, parsed, classAnnotations;
+		int number = 0;
+
+		let reader = this->getReader(),
+			this->_entries = [],
+			self::_fileHashes = [];
+
+		for className in classes {
+
+			let parsed = reader->parse(className);
+			if typeof parsed != "array" {
+				continue;
+			}
+
+			let classAnnotations = new Reflection(parsed),
+				this->_annotations[className] = classAnnotations;
+
+			this->write(className, classAnnotations);
+			let number++;
+		}
+
+		let self::_bundles[this->_bundleFile] = this->_entries;
+		this->_save();
+
+		return number;
+	}
+
+	/**
+	 * Returns the entries of the bundle loading the file the first time it's used in the process
+	 */
+	protected function _getEntries() -> array
+	{
+		var entries, bundles, bundleFile;
+
+		let entries = this->_entries;
+		if typeof entries == "array" {
+			return entries;
+		}
+
+		let bundleFile = this->_bundleFile,
+			bundles = self::_bundles;
+
+		if !fetch entries, bundles[bundleFile] {
+
+			let entries = null;
+			if file_exists(bundleFile) {
+				let entries = require bundleFile;
+			}
+
+			if typeof entries != "array" {
+				let entries = [];
+			}
+
+			let self::_bundles[bundleFile] = entries;
+		}
+
+		let this->_entries = entries;
+		return entries;
+	}
+
+	/**
+	 * Returns the hash of a file computing it only the first time the file is checked in the process
+	 */
+	protected function _getFileHash(string path) -> string
+	{
+		var hashes, hash;
+
+		let hashes = self::_fileHashes;
+		if fetch hash, hashes[path] {
+			return hash;
+		}
+
+		let hash = this->_hashFile(path),
+			self::_fileHashes[path] = hash;
+
+		return hash;
+	}
+
+	/**
+	 * Hashes the contents of the file that declares a class
+	 */
+	protected function _hashFile(string path) -> string
+	{
+		var hash;
+
+		if path == "" {
+			return "";
+		}
+
+		let hash = md5_file(path);
+		if typeof hash != "string" {
+			return "";
+		}
+
+		return hash;
+	}
+
+	/**
+	 * Writes the whole bundle, the file is written to a temporary file in the same directory
+	 * and renamed over the bundle so concurrent readers never see a partial file
+	 */
+	protected function _save()
+	{
+		var bundleFile, temporaryPath;
+
+		let bundleFile = this->_bundleFile,
+			temporaryPath = tempnam(dirname(bundleFile), "annotations");
+
+		if typeof temporaryPath != "string" {
+			throw new Exception("Annotations bundle cannot be written");
+		}
+
+		if file_put_contents(temporaryPath, "<?php return " . var_export(this->_entries, true) . "; ") === false {
+			unlink(temporaryPath);
+			throw new Exception("Annotations bundle cannot be written");
+		}
+
+		chmod(temporaryPath, 0644);
+
+		if !rename(temporaryPath, bundleFile) {
+			unlink(temporaryPath);
+			throw new Exception("Annotations bundle cannot be written");
+		}
+
+		if function_exists("opcache_invalidate") {
+			opcache_invalidate(bundleFile, true);
+		}
+	}
+}
@@ -0,0 +1,39 @@
+
+/*
+ +------------------------------------------------------------------------+
+ | Phalcon Framework                                                      |
+ +------------------------------------------------------------------------+
+ | Copyright (c) 2011-2015 Phalcon Team (http://www.phalconphp.com)       |
+ +------------------------------------------------------------------------+
+ | This source file is subject to the New BSD License that is bundled     |
+ | with this package in the file docs/LICENSE.txt.                        |
+ |                                                                        |
+ | If you did not receive a copy of the license and are unable to         |
+ | obtain it through the world-wide-web, please send an email             |
+ | to license@phalconphp.com so we can send you a copy immediately.       |
+ +------------------------------------------------------------------------+
+ | Authors: Andres Gutierrez <andres@phalconphp.com>                      |
+ |          Eduar Carvajal <eduar@phalconphp.com>                         |
+ +------------------------------------------------------------------------+
+ */
+
+namespace Phalcon\Assets;
+
+/**
+ * Phalcon\Assets\CompressorInterface
+ *
+ * Interface for compressors writing precompressed copies of the built assets
+ */
+interface CompressorInterface
+{
+
+	/**
+	 * Returns the extension added to the path of the compressed copy
+	 */
+	public function getExtension() -> string;
+
+	/**
+	 * Compresses the content returning the encoded string
+	 */
+	public function compress(string! content) -> string;
+}
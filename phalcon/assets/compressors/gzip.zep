@@ -0,0 +1,70 @@
+
+/*
+ +------------------------------------------------------------------------+
+ | Phalcon Framework                                                      |
+ +------------------------------------------------------------------------+
+ | Copyright (c) 2011-2015 Phalcon Team (http://www.phalconphp.com)       |
+ +------------------------------------------------------------------------+
+ | This source file is subject to the New BSD License that is bundled     |
+ | with this package in the file docs/LICENSE.txt.                        |
+ |                                                                        |
+ | If you did not receive a copy of the license and are unable to         |
+ | obtain it through the world-wide-web, please send an email             |
+ | to license@phalconphp.com so we can send you a copy immediately.       |
+ +------------------------------------------------------------------------+
+ | Authors: Andres Gutierrez <andres@phalconphp.com>                      |
+ |          Eduar Carvajal <eduar@phalconphp.com>                         |
+ +------------------------------------------------------------------------+
+ */
+
+namespace Phalcon\Assets\Compressors;
+
+use Phalcon\Assets\Exception;
+use Phalcon\Assets\CompressorInterface;
+
+/**
+ * Phalcon\Assets\Compressors\Gzip
+ *
+ * Writes a .gz copy of the built assets at the highest compression level, it can be
+ * served directly by the web server (gzip_static in nginx)
+ */
+class Gzip implements CompressorInterface
+{
+
+	protected _level = 9;
+
+	/**
+	 * Phalcon\Assets\Compressors\Gzip constructor
+	 */
+	public function __construct(int level = 9)
+	{
+		let this->_level = level;
+	}
+
+	/**
+	 * Returns the extension added to the path of the compressed copy
+	 */
+	public function getExtension() -> string
+	{
+		return "gz";
+	}
+
+	/**
+	 * Compresses the content using gzip
+	 */
+	public function compress(string! content) -> string
+	{
+		var compressed;
+
+		if !function_exists("gzencode") {
+			throw new Exception("The zlib extension is required to compress assets");
+		}
+
+		let compressed = gzencode(content, this->_level);
+		if compressed === false {
+			throw new Exception("The content cannot be compressed");
+		}
+
+		return compressed;
+	}
+}
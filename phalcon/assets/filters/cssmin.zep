@@ -38,4 +38,17 @@ class Cssmin implements FilterInterface
 	{
 		return phalcon_cssmin(content);
 	}
+
+	/**
+	 * Filters a file into another one, the source is read and the target written in
+	 * blocks so big files are never loaded completely in memory
+	 *
+	 *<code>
+	 * $filter->filterFile('vendor.css', 'public/css/vendor.min.css');
+	 *</code>
+	 */
+	public function filterFile(string! sourcePath, string! targetPath) -> boolean
+	{
+		return phalcon_cssmin_file(sourcePath, targetPath);
+	}
 }
\ No newline at end of file
@@ -38,4 +38,17 @@ class Jsmin implements FilterInterface
 	{
 		return phalcon_jsmin(content);
 	}
+
+	/**
+	 * Filters a file into another one, the source is read and the target written in
+	 * blocks so big files are never loaded completely in memory
+	 *
+	 *<code>
+	 * $filter->filterFile('vendor.js', 'public/js/vendor.min.js');
+	 *</code>
+	 */
+	public function filterFile(string! sourcePath, string! targetPath) -> boolean
+	{
+		return phalcon_jsmin_file(sourcePath, targetPath);
+	}
 }
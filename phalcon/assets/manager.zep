@@ -23,6 +23,7 @@ use Phalcon\Tag;
 use Phalcon\Assets\Resource;
 use Phalcon\Assets\Collection;
 use Phalcon\Assets\Exception;
+use Phalcon\Assets\CompressorInterface;
 use Phalcon\Assets\Resource\Js as ResourceJs;
 use Phalcon\Assets\Resource\Css as ResourceCss;
 
@@ -44,6 +45,18 @@ class Manager
 
 	protected _implicitOutput = true;
 
+	/**
+	 * Collections already built, indexed by their name
+	 * @var array
+	 */
+	protected _manifest;
+
+	/**
+	 * Compressors writing encoded copies of the built files
+	 * @var array
+	 */
+	protected _compressors;
+
 	/**
 	 * Phalcon\Assets\Manager
 	 *
@@ -300,6 +313,116 @@ class Manager
 		return collection;
 	}
 
+	/**
+	 * Processes every filtered collection once writing its output to a file whose name
+	 * contains a hash of the content. Returns the manifest with the files to include for
+	 * each collection, if a path is passed the manifest is written to be loaded later by loadManifest()
+	 *
+	 *<code>
+	 * $assets->build('app/cache/assets.php');
+	 *</code>
+	 */
+	public function build(string manifestPath = null) -> array
+	{
+		var manifest, collections, name, collection, entries;
+
+		let manifest = [],
+			collections = this->_collections;
+
+		if typeof collections == "array" {
+			for name, collection in collections {
+				let entries = this->_buildCollection(collection);
+				if typeof entries == "array" {
+					let manifest[name] = entries;
+				}
+			}
+		}
+
+		if manifestPath {
+			this->_writeFile(manifestPath, "<?php return " . var_export(manifest, true) . "; ");
+			if function_exists("opcache_invalidate") {
+				opcache_invalidate(manifestPath, true);
+			}
+		}
+
+		let this->_manifest = manifest;
+
+		return manifest;
+	}
+
+	/**
+	 * Loads a manifest generated by build(). Collections in the manifest are printed
+	 * by outputCss()/outputJs() without checking or filtering their resources
+	 *
+	 *<code>
+	 * $assets->loadManifest('app/cache/assets.php');
+	 *</code>
+	 */
+	public function loadManifest(string! manifestPath) -> boolean
+	{
+		var manifest;
+
+		if !file_exists(manifestPath) {
+			return false;
+		}
+
+		let manifest = require manifestPath;
+		if typeof manifest != "array" {
+			return false;
+		}
+
+		let this->_manifest = manifest;
+
+		return true;
+	}
+
+	/**
+	 * Sets the manifest of built collections
+	 */
+	public function setManifest(array! manifest) -> <Manager>
+	{
+		let this->_manifest = manifest;
+		return this;
+	}
+
+	/**
+	 * Returns the manifest of built collections
+	 *
+	 * @return array
+	 */
+	public function getManifest()
+	{
+		return this->_manifest;
+	}
+
+	/**
+	 * Adds a compressor, build() writes a copy of every built file encoded by it
+	 *
+	 *<code>
+	 * $assets->addCompressor(new \Phalcon\Assets\Compressors\Gzip());
+	 *</code>
+	 */
+	public function addCompressor(<CompressorInterface> compressor) -> <Manager>
+	{
+		let this->_compressors[] = compressor;
+		return this;
+	}
+
+	/**
+	 * Returns the compressors used by build()
+	 */
+	public function getCompressors() -> array
+	{
+		var compressors;
+
+		let compressors = this->_compressors;
+		if typeof compressors != "array" {
+			return [];
+		}
+
+		return compressors;
+	}
+
 	/**
 	 * Traverses a collection calling the callback to generate its HTML
 	 *
@@ -309,9 +432,8 @@ class Manager
 	 */
 	public function output(<Collection> collection, callback, type)
 	{
-		var output, resources, filters, prefix, sourceBasePath = null,
-			targetBasePath = null, options, collectionSourcePath, completeSourcePath,
-			collectionTargetPath, completeTargetPath, filteredJoinedContent, join,
+		var output, resources, filters, prefix, paths, completeSourcePath,
+			completeTargetPath, filteredJoinedContent, join,
 			$resource, filterNeeded, local, sourcePath, targetPath, path, prefixedPath,
 			attributes, parameters, html, useImplicitOutput, content, mustFilter,
 			filter, filteredContent, typeCss, targetUri;
@@ -343,51 +465,12 @@ class Manager
 		 */
 		if count(filters) {
 
-			let options = this->_options;
-
 			/**
-			 * Check for global options in the assets manager
+			 * Complete source and target paths of the collection
 			 */
-			if typeof options == "array" {
-
-				/**
-				 * The source base path is a global location where all resources are located
-				 */
-				fetch sourceBasePath, options["sourceBasePath"];
-
-				/**
-				 * The target base path is a global location where all resources are written
-				 */
-				fetch targetBasePath, options["targetBasePath"];
-			}
-
-			/**
-			 * Check if the collection have its own source base path
-			 */
-			let collectionSourcePath = collection->getSourcePath();
-
-			/**
-			 * Concatenate the global base source path with the collection one
-			 */
-			if collectionSourcePath {
-				let completeSourcePath = sourceBasePath . collectionSourcePath;
-			} else {
-				let completeSourcePath = sourceBasePath;
-			}
-
-			/**
-			 * Check if the collection have its own target base path
-			 */
-			let collectionTargetPath = collection->getTargetPath();
-
-			/**
-			 * Concatenate the global base source path with the collection one
-			 */
-			if collectionTargetPath {
-				let completeTargetPath = targetBasePath . collectionTargetPath;
-			} else {
-				let completeTargetPath = targetBasePath;
-			}
+			let paths = this->_getCollectionPaths(collection),
+				completeSourcePath = paths[0],
+				completeTargetPath = paths[1];
 
 			/**
 			 * Global filtered content
@@ -398,22 +481,6 @@ class Manager
 			 * Check if the collection have its own target base path
 			 */
 			let join = collection->getJoin();
-
-			/**
-			 * Check for valid target paths if the collection must be joined
-			 */
-			if join {
-				/**
-				* We need a valid final target path
-				*/
-				if !completeTargetPath {
-					throw new Exception("Path '". completeTargetPath. "' is not a valid target path (1)");
-				}
-
-				if is_dir(completeTargetPath) {
-					throw new Exception("Path '". completeTargetPath. "' is not a valid target path (2), is dir.");
-				}
-			}
 		}
 
 		/**
@@ -433,52 +500,22 @@ class Manager
 			 * If the collection must not be joined we must print a HTML for each one
 			 */
 			if count(filters) {
-				if local {
 
-					/**
-					 * Get the complete path
-					 */
-					let sourcePath = $resource->getRealSourcePath();
-
-					/**
-					 * We need a valid source path
-					 */
-					if !sourcePath {
-						let sourcePath = $resource->getPath();
-						throw new Exception("Resource '". sourcePath. "' does not have a valid source path");
-					}
-				} else {
+				/**
+				 * Get the source and the target path, we need to write the filtered content to a file
+				 */
+				let paths = this->_getResourcePaths($resource, completeTargetPath),
+					sourcePath = paths[0],
+					targetPath = paths[1];
 
-					/**
-					 * Get the complete source path
-					 */
-					let sourcePath = $resource->getPath();
+				if !local {
 
 					/**
 					 * resources paths are always filtered
 					 */
 					let filterNeeded = true;
-				}
-
-				/**
-				 * Get the target path, we need to write the filtered content to a file
-				 */
-				let targetPath = $resource->getRealTargetPath(completeTargetPath);
-
-				/**
-				 * We need a valid final target path
-				 */
-				if !targetPath {
-					throw new Exception("Resource '". sourcePath. "' does not have a valid target path");
-				}
 
-				if local {
-					/**
-					 * Make sure the target path is not the same source path
-					 */
-					if targetPath == sourcePath {
-						throw new Exception("Resource '". targetPath. "' have the same source and target paths");
-					}
+				} else {
 
 					if file_exists(targetPath) {
 						if compare_mtime(targetPath, sourcePath) {
@@ -605,7 +642,7 @@ class Manager
 					 * Write the file using file-put-contents. This respects the openbase-dir also
 					 * writes to streams
 					 */
-					file_put_contents(targetPath, filteredContent);
+					this->_writeFile(targetPath, filteredContent);
 				}
 			}
 
@@ -668,7 +705,7 @@ class Manager
 				 * Write the file using file_put_contents. This respects the openbase-dir also
 				 * writes to streams
 				 */
-				file_put_contents(completeTargetPath, filteredJoinedContent);
+				this->_writeFile(completeTargetPath, filteredJoinedContent);
 
 				/**
 				 * Generate the HTML using the original path in the resource
@@ -792,12 +829,24 @@ class Manager
 	 */
 	public function outputCss(collectionName = null)
 	{
-		var collection;
+		var collection, name, manifest, entries;
 
 		if !collectionName {
-			let collection = this->getCss();
+			let collection = this->getCss(),
+				name = "css";
 		} else {
-			let collection = this->get(collectionName);
+			let collection = this->get(collectionName),
+				name = collectionName;
+		}
+
+		/**
+		 * Built collections are taken from the manifest
+		 */
+		let manifest = this->_manifest;
+		if typeof manifest == "array" {
+			if fetch entries, manifest[name] {
+				return this->_outputManifest(collection, entries, ["Phalcon\\Tag", "stylesheetLink"]);
+			}
 		}
 
 		return this->output(collection, ["Phalcon\\Tag", "stylesheetLink"], "css");
@@ -828,12 +877,24 @@ class Manager
 	 */
 	public function outputJs(collectionName = null)
 	{
-		var collection;
+		var collection, name, manifest, entries;
 
 		if !collectionName {
-			let collection = this->getJs();
+			let collection = this->getJs(),
+				name = "js";
 		} else {
-			let collection = this->get(collectionName);
+			let collection = this->get(collectionName),
+				name = collectionName;
+		}
+
+		/**
+		 * Built collections are taken from the manifest
+		 */
+		let manifest = this->_manifest;
+		if typeof manifest == "array" {
+			if fetch entries, manifest[name] {
+				return this->_outputManifest(collection, entries, ["Phalcon\\Tag", "javascriptInclude"]);
+			}
 		}
 
 		return this->output(collection, ["Phalcon\\Tag", "javascriptInclude"], "js");
@@ -856,4 +917,329 @@ class Manager
 
 		return this->outputInline(collection, "script");
 	}
+
+	/**
+	 * Filters and writes the resources of a collection returning the files to include,
+	 * collections without filters are not built
+	 */
+	protected function _buildCollection(<Collection> collection)
+	{
+		var filters, paths, completeSourcePath, completeTargetPath, join, entries,
+			joinedContent, $resource, content, targetPath, hash, typeCss;
+
+		let filters = collection->getFilters();
+		if !count(filters) {
+			return null;
+		}
+
+		let paths = this->_getCollectionPaths(collection),
+			completeSourcePath = paths[0],
+			completeTargetPath = paths[1];
+
+		let join = collection->getJoin(),
+			entries = [],
+			joinedContent = "",
+			typeCss = "css";
+
+		for $resource in collection->getResources() {
+
+			let paths = this->_getResourcePaths($resource, completeTargetPath),
+				targetPath = paths[1];
+
+			let content = $resource->getContent(completeSourcePath);
+
+			if $resource->getFilter() {
+				let content = this->_applyFilters(filters, content);
+				if join && $resource->getType() != typeCss {
+					let content .= ";";
+				}
+			}
+
+			if join {
+				let joinedContent .= content;
+				continue;
+			}
+
+			let hash = substr(md5(content), 0, 8);
+
+			this->_writeBuiltFile(this->_getHashedPath(targetPath, hash), content);
+
+			/**
+			 * Filtered resources are always local
+			 */
+			let entries[] = [this->_getHashedPath($resource->getRealTargetUri(), hash), true, $resource->getAttributes()];
+		}
+
+		if join {
+
+			let hash = substr(md5(joinedContent), 0, 8);
+
+			this->_writeBuiltFile(this->_getHashedPath(completeTargetPath, hash), joinedContent);
+
+			let entries[] = [
+				this->_getHashedPath(collection->getTargetUri(), hash),
+				collection->getTargetLocal(),
+				collection->getAttributes()
+			];
+		}
+
+		return entries;
+	}
+
+	/**
+	 * Returns the complete source and target paths of a filtered collection, the target
+	 * of a joined collection must be a file
+	 */
+	protected function _getCollectionPaths(<Collection> collection) -> array
+	{
+		var options, sourceBasePath = null, targetBasePath = null, collectionSourcePath,
+			completeSourcePath, collectionTargetPath, completeTargetPath;
+
+		let options = this->_options;
+
+		/**
+		 * Check for global options in the assets manager
+		 */
+		if typeof options == "array" {
+
+			/**
+			 * The source base path is a global location where all resources are located
+			 */
+			fetch sourceBasePath, options["sourceBasePath"];
+
+			/**
+			 * The target base path is a global location where all resources are written
+			 */
+			fetch targetBasePath, options["targetBasePath"];
+		}
+
+		/**
+		 * Concatenate the global base source path with the collection one
+		 */
+		let collectionSourcePath = collection->getSourcePath();
+		if collectionSourcePath {
+			let completeSourcePath = sourceBasePath . collectionSourcePath;
+		} else {
+			let completeSourcePath = sourceBasePath;
+		}
+
+		/**
+		 * Concatenate the global base target path with the collection one
+		 */
+		let collectionTargetPath = collection->getTargetPath();
+		if collectionTargetPath {
+			let completeTargetPath = targetBasePath . collectionTargetPath;
+		} else {
+			let completeTargetPath = targetBasePath;
+		}
+
+		/**
+		 * Check for valid target paths if the collection must be joined
+		 */
+		if collection->getJoin() {
+
+			/**
+			 * We need a valid final target path
+			 */
+			if !completeTargetPath {
+				throw new Exception("Path '". completeTargetPath. "' is not a valid target path (1)");
+			}
+
+			if is_dir(completeTargetPath) {
+				throw new Exception("Path '". completeTargetPath. "' is not a valid target path (2), is dir.");
+			}
+		}
+
+		return [completeSourcePath, completeTargetPath];
+	}
+
+	/**
+	 * Returns the source and target paths of a resource that must be filtered,
+	 * the filtered content of a local resource can't overwrite its source
+	 */
+	protected function _getResourcePaths(<$Resource> $resource, completeTargetPath) -> array
+	{
+		var sourcePath, targetPath;
+
+		if $resource->getLocal() {
+
+			/**
+			 * Get the complete path
+			 */
+			let sourcePath = $resource->getRealSourcePath();
+
+			/**
+			 * We need a valid source path
+			 */
+			if !sourcePath {
+				let sourcePath = $resource->getPath();
+				throw new Exception("Resource '". sourcePath. "' does not have a valid source path");
+			}
+		} else {
+			let sourcePath = $resource->getPath();
+		}
+
+		let targetPath = $resource->getRealTargetPath(completeTargetPath);
+
+		/**
+		 * We need a valid final target path
+		 */
+		if !targetPath {
+			throw new Exception("Resource '". sourcePath. "' does not have a valid target path");
+		}
+
+		/**
+		 * Make sure the target path is not the same source path
+		 */
+		if $resource->getLocal() {
+			if targetPath == sourcePath {
+				throw new Exception("Resource '". targetPath. "' have the same source and target paths");
+			}
+		}
+
+		return [sourcePath, targetPath];
+	}
+
+	/**
+	 * Passes the content through every filter of a collection
+	 */
+	protected function _applyFilters(array filters, string content) -> string
+	{
+		var filter;
+
+		for filter in filters {
+
+			/**
+			 * Filters must be valid objects
+			 */
+			if typeof filter != "object" {
+				throw new Exception("Filter is invalid");
+			}
+
+			let content = filter->filter(content);
+		}
+
+		return content;
+	}
+
+	/**
+	 * Generates the HTML of a built collection from its manifest entries
+	 */
+	protected function _outputManifest(<Collection> collection, array entries, callback)
+	{
+		var output, prefix, entry, path, attributes, parameters, html;
+
+		let output = "",
+			prefix = collection->getPrefix();
+
+		for entry in entries {
+
+			if prefix {
+				let path = prefix . entry[0];
+			} else {
+				let path = entry[0];
+			}
+
+			let attributes = entry[2],
+				parameters = [];
+			if typeof attributes == "array" {
+				let attributes[0] = path;
+				let parameters[] = attributes;
+			} else {
+				let parameters[] = path;
+			}
+			let parameters[] = entry[1];
+
+			let html = call_user_func_array(callback, parameters);
+
+			if this->_implicitOutput == true {
+				echo html;
+			} else {
+				let output .= html;
+			}
+		}
+
+		return output;
+	}
+
+	/**
+	 * Adds the hash of the content before the extension of a path or uri
+	 */
+	protected function _getHashedPath(string path, string hash) -> string
+	{
+		var dot, slash;
+
+		let dot = strrpos(path, "."),
+			slash = strrpos(path, "/");
+
+		if dot === false {
+			return path . "." . hash;
+		}
+
+		if slash !== false && slash > dot {
+			return path . "." . hash;
+		}
+
+		return substr(path, 0, dot) . "." . hash . substr(path, dot);
+	}
+
+	/**
+	 * Writes a built file and a sibling with the content encoded by every compressor
+	 */
+	protected function _writeBuiltFile(string path, string content) -> void
+	{
+		var compressors, compressor;
+
+		this->_writeFile(path, content);
+
+		let compressors = this->_compressors;
+		if typeof compressors == "array" {
+			for compressor in compressors {
+				this->_writeFile(path . "." . compressor->getExtension(), compressor->compress(content));
+			}
+		}
+	}
+
+	/**
+	 * Writes a file through a temporary file in the same directory renamed over the target,
+	 * so concurrent requests never read a partially written file. Streams are written
+	 * directly because a rename can't cross stream wrappers
+	 */
+	protected function _writeFile(string path, content) -> void
+	{
+		var temporaryPath, mode;
+
+		if memstr(path, "://") {
+			if file_put_contents(path, content) === false {
+				throw new Exception("Path '" . path . "' cannot be written");
+			}
+			return;
+		}
+
+		let temporaryPath = tempnam(dirname(path), "phalcon");
+		if typeof temporaryPath != "string" {
+			throw new Exception("Path '" . path . "' cannot be written");
+		}
+
+		if file_put_contents(temporaryPath, content) === false {
+			unlink(temporaryPath);
+			throw new Exception("Path '" . path . "' cannot be written");
+		}
+
+		/**
+		 * tempnam() creates the file readable only by its owner, the target keeps its mode
+		 * or gets the one a new file would have under the current umask
+		 */
+		if file_exists(path) {
+			let mode = fileperms(path) & 0777;
+		} else {
+			let mode = 0666 & ~umask();
+		}
+		chmod(temporaryPath, mode);
+
+		if !rename(temporaryPath, path) {
+			unlink(temporaryPath);
+			throw new Exception("Path '" . path . "' cannot be written");
+		}
+	}
 }
@@ -439,6 +439,144 @@ class Libmemcached extends Backend implements BackendInterface
 		return memcache->decrement(lastKey, value);
 	}
 
+	/**
+	 * Returns a cached content together with the CAS token of its stored version
+	 * as ["content": ..., "cas": ...], or null if the key doesn't exist
+	 *
+	 *<code>
+	 * $item = $cache->getWithCas('my-data');
+	 *</code>
+	 *
+	 * @param int|string keyName
+	 * @return array
+	 */
+	public function getWithCas(keyName)
+	{
+		var memcache, prefixedKey, items, item, cachedContent;
+
+		let memcache = this->_memcache;
+		if typeof memcache != "object" {
+			this->_connect();
+			let memcache = this->_memcache;
+		}
+
+		let prefixedKey = this->_prefix . keyName;
+		let this->_lastKey = prefixedKey;
+
+		if !memcache->getDelayed([prefixedKey], true) {
+			return null;
+		}
+
+		let items = memcache->fetchAll();
+		if typeof items != "array" {
+			return null;
+		}
+
+		if !fetch item, items[0] {
+			return null;
+		}
+
+		let cachedContent = item["value"];
+		if !is_numeric(cachedContent) {
+			let cachedContent = this->_frontend->afterRetrieve(cachedContent);
+		}
+
+		return ["content": cachedContent, "cas": item["cas"]];
+	}
+
+	/**
+	 * Stores a content only if the key wasn't modified since its CAS token was obtained
+	 * with getWithCas(), a null token stores the content only if the key doesn't exist
+	 *
+	 *<code>
+	 * $item = $cache->getWithCas('my-data');
+	 * if (!$cache->saveWithCas('my-data', $data, $item['cas'])) {
+	 *     // The data was changed by another process
+	 * }
+	 *</code>
+	 *
+	 * @param int|string keyName
+	 * @param string content
+	 * @param double cas
+	 * @param long lifetime
+	 * @return boolean
+	 */
+	public function saveWithCas(keyName, content, cas, lifetime = null) -> boolean
+	{
+		var memcache, prefixedKey, preparedContent, success, options, specialKey, keys;
+
+		let memcache = this->_memcache;
+		if typeof memcache != "object" {
+			this->_connect();
+			let memcache = this->_memcache;
+		}
+
+		let prefixedKey = this->_prefix . keyName;
+		let this->_lastKey = prefixedKey;
+
+		if is_numeric(content) {
+			let preparedContent = content;
+		} else {
+			let preparedContent = this->_frontend->beforeStore(content);
+		}
+
+		if !lifetime {
+			let lifetime = this->_frontend->getLifetime();
+		}
+
+		if typeof cas == "null" {
+			let success = memcache->add(prefixedKey, preparedContent, lifetime);
+		} else {
+			let success = memcache->cas(cas, prefixedKey, preparedContent, lifetime);
+		}
+
+		if !success {
+			return false;
+		}
+
+		let options = this->_options;
+		if fetch specialKey, options["statsKey"] {
+			if specialKey != "" {
+				let keys = memcache->get(specialKey);
+				if typeof keys != "array" {
+					let keys = [];
+				}
+
+				if !isset keys[prefixedKey] {
+					let keys[prefixedKey] = lifetime;
+					memcache->set(specialKey, keys);
+				}
+			}
+		}
+
+		return true;
+	}
+
+	/**
+	 * Sets a new lifetime to a cached content without sending it again
+	 * (requires the binary protocol)
+	 *
+	 * @param int|string keyName
+	 * @param long lifetime
+	 * @return boolean
+	 */
+	public function touch(keyName, lifetime = null) -> boolean
+	{
+		var memcache;
+
+		let memcache = this->_memcache;
+		if typeof memcache != "object" {
+			this->_connect();
+			let memcache = this->_memcache;
+		}
+
+		if !lifetime {
+			let lifetime = this->_frontend->getLifetime();
+		}
+
+		return memcache->touch(this->_prefix . keyName, lifetime);
+	}
+
 	/**
 	 * Immediately invalidates all existing items.
 	 *
@@ -23,6 +23,7 @@ namespace Phalcon;
 use Phalcon\DiInterface;
 use Phalcon\Di\InjectionAwareInterface;
 use Phalcon\Di\Service;
+use Phalcon\Di\Service\Compiler;
 use Phalcon\Di\ServiceInterface;
 use Phalcon\Di\Exception;
 use Phalcon\Events\EventsAwareInterface;
@@ -68,6 +69,8 @@ class Di implements DiInterface, EventsAwareInterface
 
 	protected _freshInstance = false;
 
+	protected _requestScoped;
+
 	/**
 	 * Events Manager
 	 *
@@ -329,6 +332,227 @@ class Di implements DiInterface, EventsAwareInterface
 		return this->_services;
 	}
 
+	/**
+	 * Compiles the array definitions of the registered services into a PHP file
+	 * with closures that create the instances using direct calls. The compiled file
+	 * is loaded immediately and can be loaded in later requests by loadCompiled().
+	 * Returns the number of compiled services
+	 *
+	 *<code>
+	 * $di->set('logger', [
+	 *     'className' => 'Phalcon\Logger\Adapter\File',
+	 *     'arguments' => [
+	 *         ['type' => 'parameter', 'value' => '../apps/logs/error.log']
+	 *     ]
+	 * ]);
+	 *
+	 * if (!$di->loadCompiled('../cache/di.php')) {
+	 *     $di->compile('../cache/di.php');
+	 * }
+	 *</code>
+	 */
+	public function compile(string! compiledPath) -> int
+	{
+		var compiler, name, service, definition, code, compiled, temporaryPath;
+		int number = 0;
+
+		let compiler = new Compiler(),
+			compiled = "";
+
+		for name, service in this->_services {
+
+			if typeof service != "object" {
+				continue;
+			}
+
+			if !(service instanceof Service) {
+				continue;
+			}
+
+			let definition = service->getDefinition();
+			if typeof definition != "array" {
+				continue;
+			}
+
+			let code = compiler->compile(definition);
+			if typeof code != "string" {
+				continue;
+			}
+
+			/**
+			 * Every entry carries a hash of the definition so stale entries are ignored
+			 */
+			let compiled .= var_export(name, true) . " => [" . var_export(md5(var_export(definition, true)), true) . ", " . code . "],\n";
+			let number++;
+		}
+
+		/**
+		 * The file is written under a temporary name and renamed to avoid partial reads
+		 */
+		let temporaryPath = compiledPath . "." . uniqid();
+		if file_put_contents(temporaryPath, "<?php return [\n" . compiled . "];\n") === false {
+			throw new Exception("Compiled services file cannot be written");
+		}
+
+		if !rename(temporaryPath, compiledPath) {
+			throw new Exception("Compiled services file cannot be written");
+		}
+
+		this->loadCompiled(compiledPath);
+
+		return number;
+	}
+
+	/**
+	 * Loads a file previously generated by compile(). Definitions modified after the
+	 * compilation keep being resolved by Phalcon\Di\Service\Builder
+	 */
+	public function loadCompiled(string! compiledPath) -> boolean
+	{
+		var compiled, name, item, service, definition;
+
+		if !file_exists(compiledPath) {
+			return false;
+		}
+
+		let compiled = require compiledPath;
+		if typeof compiled != "array" {
+			return false;
+		}
+
+		for name, item in compiled {
+
+			if !fetch service, this->_services[name] {
+				continue;
+			}
+
+			if typeof service != "object" {
+				continue;
+			}
+
+			if !(service instanceof Service) {
+				continue;
+			}
+
+			let definition = service->getDefinition();
+			if typeof definition != "array" {
+				continue;
+			}
+
+			if md5(var_export(definition, true)) == item[0] {
+				service->setCompiled(item[1]);
+			}
+		}
+
+		return true;
+	}
+
+	/**
+	 * Marks a service as request scoped, its shared instance is discarded by resetRequestScope()
+	 *
+	 *<code>
+	 * $di->setShared('view', function() { ... });
+	 * $di->setRequestScoped('view');
+	 *</code>
+	 */
+	public function setRequestScoped(string! name, boolean requestScoped = true) -> <Di>
+	{
+		if requestScoped {
+			let this->_requestScoped[name] = true;
+		} else {
+			unset this->_requestScoped[name];
+		}
+		return this;
+	}
+
+	/**
+	 * Checks whether a service is request scoped
+	 */
+	public function isRequestScoped(string! name) -> boolean
+	{
+		return isset this->_requestScoped[name];
+	}
+
+	/**
+	 * Returns the names of the request scoped services
+	 */
+	public function getRequestScoped() -> array
+	{
+		var requestScoped;
+
+		let requestScoped = this->_requestScoped;
+		if typeof requestScoped == "array" {
+			return array_keys(requestScoped);
+		}
+		return [];
+	}
+
+	/**
+	 * Returns the shared instance of a service only if it was already resolved, unlike
+	 * getShared() the service is never built
+	 */
+	public function getResolvedShared(string! name)
+	{
+		var instance, service;
+
+		if fetch instance, this->_sharedInstances[name] {
+			return instance;
+		}
+
+		if fetch service, this->_services[name] {
+			if service instanceof Service {
+				if service->isShared() && service->isResolved() {
+					return service->resolve();
+				}
+			}
+		}
+
+		return null;
+	}
+
+	/**
+	 * Discards the shared instances that belong to the current request so the container can
+	 * serve another request in the same process. Registered services that are not request scoped
+	 * (router, url, modelsMetadata, annotations, etc.) keep their instances, instances built from
+	 * class names that aren't registered services (controllers, for instance) are discarded.
+	 * Service definitions are never modified
+	 */
+	public function resetRequestScope() -> <Di>
+	{
+		var requestScoped, sharedInstances, services, name, instance, service, kept;
+
+		let requestScoped = this->_requestScoped,
+			services = this->_services;
+
+		if typeof requestScoped != "array" {
+			let requestScoped = [];
+		}
+
+		let kept = [],
+			sharedInstances = this->_sharedInstances;
+
+		if typeof sharedInstances == "array" {
+			for name, instance in sharedInstances {
+				if isset services[name] && !isset requestScoped[name] {
+					let kept[name] = instance;
+				}
+			}
+		}
+
+		let this->_sharedInstances = kept,
+			this->_freshInstance = false;
+
+		for name, _ in requestScoped {
+			if fetch service, services[name] {
+				if service instanceof Service {
+					service->setSharedInstance(null);
+				}
+			}
+		}
+
+		return this;
+	}
+
 	/**
 	 * Check if a service is registered using the array syntax
 	 */
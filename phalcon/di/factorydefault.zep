@@ -59,5 +59,20 @@ class FactoryDefault extends \Phalcon\Di
 			"transactionManager": new Service("transactions", "Phalcon\\Mvc\\Model\\Transaction\\Manager", true),
 			"assets":             new Service("assets", "Phalcon\\Assets\\Manager", true)
 		];
+
+		/**
+		 * Services that hold state of the request being handled
+		 */
+		let this->_requestScoped = [
+			"dispatcher":   true,
+			"response":     true,
+			"cookies":      true,
+			"request":      true,
+			"flash":        true,
+			"flashSession": true,
+			"session":      true,
+			"assets":       true,
+			"view":         true
+		];
 	}
 }
\ No newline at end of file
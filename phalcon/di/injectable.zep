@@ -115,6 +115,41 @@ abstract class Injectable implements InjectionAwareInterface, EventsAwareInterfa
 		return this->_eventsManager;
 	}
 
+	/**
+	 * Releases the services of the current request: deferred session bags are written,
+	 * the models manager drops its reusable objects if it was used, the container discards
+	 * the request scoped instances and the ones cached in this object are removed, so
+	 * they're resolved again on their next access
+	 */
+	protected function _resetRequestScope(<DiInterface> dependencyInjector) -> void
+	{
+		var modelsManager, name;
+
+		/**
+		 * Deferred session bags are written while the session is still available
+		 */
+		\Phalcon\Session\Bag::writePending();
+
+		if !(dependencyInjector instanceof \Phalcon\Di) {
+			return;
+		}
+
+		let modelsManager = dependencyInjector->getResolvedShared("modelsManager");
+		if typeof modelsManager == "object" {
+			if method_exists(modelsManager, "clearReusableObjects") {
+				modelsManager->clearReusableObjects();
+			}
+		}
+
+		dependencyInjector->resetRequestScope();
+
+		for name in dependencyInjector->getRequestScoped() {
+			if isset this->{name} {
+				unset this->{name};
+			}
+		}
+	}
+
 	/**
 	 * Magic method __get
 	 */
@@ -48,6 +48,8 @@ class Service implements ServiceInterface
 
 	protected _sharedInstance;
 
+	protected _compiled;
+
 	/**
 	 * Phalcon\Di\Service
 	 *
@@ -103,7 +105,8 @@ class Service implements ServiceInterface
 	 */
 	public function setDefinition(definition) -> void
 	{
-		let this->_definition = definition;
+		let this->_definition = definition,
+			this->_compiled = null;
 	}
 
 	/**
@@ -126,7 +129,7 @@ class Service implements ServiceInterface
 	public function resolve(parameters = null, <DiInterface> dependencyInjector = null)
 	{
 		boolean found;
-		var shared, definition, sharedInstance, instance, builder, reflection;
+		var shared, definition, sharedInstance, instance, builder, reflection, compiled;
 
 		let shared = this->_shared;
 
@@ -197,8 +200,16 @@ class Service implements ServiceInterface
 				 * Array definitions require a 'className' parameter
 				 */
 				if typeof definition == "array" {
-					let builder = new Builder(),
-						instance = builder->build(dependencyInjector, definition, parameters);
+					let compiled = this->_compiled;
+					if compiled !== null {
+						/**
+						 * Compiled definitions create the instance with direct calls
+						 */
+						let instance = call_user_func(compiled, dependencyInjector, parameters);
+					} else {
+						let builder = new Builder(),
+							instance = builder->build(dependencyInjector, definition, parameters);
+					}
 				} else {
 					let found = false;
 				}
@@ -224,6 +235,27 @@ class Service implements ServiceInterface
 		return instance;
 	}
 
+	/**
+	 * Sets a compiled version of an array definition
+	 *
+	 * @see Phalcon\Di\Service\Compiler
+	 * @param Closure compiled
+	 */
+	public function setCompiled(<\Closure> compiled) -> void
+	{
+		let this->_compiled = compiled;
+	}
+
+	/**
+	 * Returns the compiled version of the definition if any
+	 *
+	 * @return Closure
+	 */
+	public function getCompiled()
+	{
+		return this->_compiled;
+	}
+
 	/**
 	 * Changes a parameter in the definition without resolve the service
 	 */
@@ -251,9 +283,10 @@ class Service implements ServiceInterface
 		let definition["arguments"] = arguments;
 
 		/**
-		 * Re-update the definition
+		 * Re-update the definition, a compiled closure of the old definition is stale
 		 */
-		let this->_definition = definition;
+		let this->_definition = definition,
+			this->_compiled = null;
 
 		return this;
 	}
@@ -0,0 +1,258 @@
+
+/*
+ +------------------------------------------------------------------------+
+ | Phalcon Framework                                                      |
+ +------------------------------------------------------------------------+
+ | Copyright (c) 2011-2015 Phalcon Team (http://www.phalconphp.com)       |
+ +------------------------------------------------------------------------+
+ | This source file is subject to the New BSD License that is bundled     |
+ | with this package in the file docs/LICENSE.txt.                        |
+ |                                                                        |
+ | If you did not receive a copy of the license and are unable to         |
+ | obtain it through the world-wide-web, please send an email             |
+ | to license@phalconphp.com so we can send you a copy immediately.       |
+ +------------------------------------------------------------------------+
+ | Authors: Andres Gutierrez <andres@phalconphp.com>                      |
+ |          Eduar Carvajal <eduar@phalconphp.com>                         |
+ +------------------------------------------------------------------------+
+ */
+
+namespace Phalcon\Di\Service;
+
+/**
+ * Phalcon\Di\Service\Compiler
+ *
+ * This class compiles complex definitions into PHP closures that create the
+ * instances using direct constructor and method calls
+ */
+class Compiler
+{
+
+	/**
+	 * Checks if a value can be exported as PHP code
+	 *
+	 * @param mixed value
+	 * @return boolean
+	 */
+	private function _isExportable(value) -> boolean
+	{
+		var item;
+
+		if typeof value == "object" || typeof value == "resource" {
+			return false;
+		}
+
+		if typeof value == "array" {
+			for item in value {
+				if !this->_isExportable(item) {
+					return false;
+				}
+			}
+		}
+
+		return true;
+	}
+
+	/**
+	 * Compiles a constructor/call parameter
+	 *
+	 * @param array argument
+	 * @return string|boolean
+	 */
+	private function _compileParameter(argument) -> string | boolean
+	{
+		var type, name, value, instanceArguments;
+
+		if typeof argument != "array" {
+			return false;
+		}
+
+		if !fetch type, argument["type"] {
+			return false;
+		}
+
+		switch type {
+
+			case "service":
+				if !fetch name, argument["name"] {
+					return false;
+				}
+				if !this->_isExportable(name) {
+					return false;
+				}
+				return "$dependencyInjector->get(" . var_export(name, true) . ")";
+
+			case "parameter":
+				if !fetch value, argument["value"] {
+					return false;
+				}
+				if !this->_isExportable(value) {
+					return false;
+				}
+				return var_export(value, true);
+
+			case "instance":
+				if !fetch name, argument["className"] {
+					return false;
+				}
+				if !this->_isExportable(name) {
+					return false;
+				}
+				if fetch instanceArguments, argument["arguments"] {
+					if !this->_isExportable(instanceArguments) {
+						return false;
+					}
+					return "$dependencyInjector->get(" . var_export(name, true) . ", " . var_export(instanceArguments, true) . ")";
+				}
+				return "$dependencyInjector->get(" . var_export(name, true) . ")";
+		}
+
+		return false;
+	}
+
+	/**
+	 * Compiles a list of constructor/call parameters
+	 *
+	 * @param array arguments
+	 * @return string|boolean
+	 */
+	private function _compileParameters(arguments) -> string | boolean
+	{
+		var argument, compiled, compiledArguments;
+
+		if typeof arguments != "array" {
+			return false;
+		}
+
+		let compiledArguments = [];
+		for argument in arguments {
+			let compiled = this->_compileParameter(argument);
+			if typeof compiled != "string" {
+				return false;
+			}
+			let compiledArguments[] = compiled;
+		}
+
+		return join(", ", compiledArguments);
+	}
+
+	/**
+	 * Compiles an array definition into the PHP code of a closure receiving the
+	 * dependency injector and the optional parameters. Returns false if the
+	 * definition cannot be compiled, for instance, when it contains objects
+	 *
+	 * @param array definition
+	 * @return string|boolean
+	 */
+	public function compile(array! definition) -> string | boolean
+	{
+		var className, arguments, constructorArguments, paramCalls, method,
+			methodName, property, propertyName, propertyValue, compiled, code;
+
+		if !fetch className, definition["className"] {
+			return false;
+		}
+
+		if typeof className != "string" {
+			return false;
+		}
+
+		if !preg_match("/^\\\\?[a-zA-Z_][a-zA-Z0-9_]*(\\\\[a-zA-Z_][a-zA-Z0-9_]*)*$/", className) {
+			return false;
+		}
+
+		let className = "\\" . ltrim(className, "\\");
+
+		if fetch arguments, definition["arguments"] {
+			let constructorArguments = this->_compileParameters(arguments);
+			if typeof constructorArguments != "string" {
+				return false;
+			}
+		} else {
+			let constructorArguments = "";
+		}
+
+		/**
+		 * Runtime parameters replace the definition arguments as in Phalcon\Di\Service\Builder
+		 */
+		let code = "function($dependencyInjector, $parameters = null) {\n" .
+			"\tif (is_array($parameters)) {\n" .
+			"\t\tif (count($parameters)) {\n" .
+			"\t\t\t$reflection = new \\ReflectionClass(" . var_export(className, true) . ");\n" .
+			"\t\t\t$instance = $reflection->newInstanceArgs($parameters);\n" .
+			"\t\t} else {\n" .
+			"\t\t\t$instance = new " . className . "();\n" .
+			"\t\t}\n" .
+			"\t} else {\n" .
+			"\t\t$instance = new " . className . "(" . constructorArguments . ");\n" .
+			"\t}\n";
+
+		if fetch paramCalls, definition["calls"] {
+
+			if typeof paramCalls != "array" {
+				return false;
+			}
+
+			for method in paramCalls {
+
+				if typeof method != "array" {
+					return false;
+				}
+
+				if !fetch methodName, method["method"] {
+					return false;
+				}
+
+				if !this->_isExportable(methodName) {
+					return false;
+				}
+
+				if fetch arguments, method["arguments"] {
+					let compiled = this->_compileParameters(arguments);
+					if typeof compiled != "string" {
+						return false;
+					}
+				} else {
+					let compiled = "";
+				}
+
+				let code .= "\t$instance->{" . var_export(methodName, true) . "}(" . compiled . ");\n";
+			}
+		}
+
+		if fetch paramCalls, definition["properties"] {
+
+			if typeof paramCalls != "array" {
+				return false;
+			}
+
+			for property in paramCalls {
+
+				if typeof property != "array" {
+					return false;
+				}
+
+				if !fetch propertyName, property["name"] {
+					return false;
+				}
+
+				if !this->_isExportable(propertyName) {
+					return false;
+				}
+
+				if !fetch propertyValue, property["value"] {
+					return false;
+				}
+
+				let compiled = this->_compileParameter(propertyValue);
+				if typeof compiled != "string" {
+					return false;
+				}
+
+				let code .= "\t$instance->{" . var_export(propertyName, true) . "} = " . compiled . ";\n";
+			}
+		}
+
+		return code . "\treturn $instance;\n}";
+	}
+}
@@ -74,6 +74,10 @@ abstract class Dispatcher implements DispatcherInterface, InjectionAwareInterfac
 
 	protected _previousActionName = null;
 
+	protected static _handlerClasses;
+
+	protected static _handlerMethods;
+
 	const EXCEPTION_NO_DI = 0;
 
 	const EXCEPTION_CYCLIC_ROUTING = 1;
@@ -315,7 +319,7 @@ abstract class Dispatcher implements DispatcherInterface, InjectionAwareInterfac
 		var value, handler, dependencyInjector, namespaceName, handlerName,
 			actionName, camelizedClass, params, eventsManager,
 			handlerSuffix, actionSuffix, handlerClass, status, actionMethod,
-			wasFresh = false, e;
+			wasFresh = false, e, handlerClasses, cacheKey, className;
 
 		let dependencyInjector = <DiInterface> this->_dependencyInjector;
 		if typeof dependencyInjector != "object" {
@@ -386,22 +390,32 @@ abstract class Dispatcher implements DispatcherInterface, InjectionAwareInterfac
 				}
 			}
 
-			// We don't camelize the classes if they are in namespaces
-			if !memstr(handlerName, "\\") {
-				let camelizedClass = camelize(handlerName);
-			} else {
-				let camelizedClass = handlerName;
-			}
+			// Resolved handler classes are cached per process
+			let cacheKey = namespaceName . "|" . handlerName . "|" . handlerSuffix,
+				handlerClasses = self::_handlerClasses;
 
-			// Create the complete controller class name prepending the namespace
-			if namespaceName {
-				if ends_with(namespaceName, "\\") {
-					let handlerClass = namespaceName . camelizedClass . handlerSuffix;
+			if !fetch handlerClass, handlerClasses[cacheKey] {
+
+				// We don't camelize the classes if they are in namespaces
+				if !memstr(handlerName, "\\") {
+					let camelizedClass = camelize(handlerName);
 				} else {
-					let handlerClass = namespaceName . "\\" . camelizedClass . handlerSuffix;
+					let camelizedClass = handlerName;
 				}
-			} else {
-				let handlerClass = camelizedClass . handlerSuffix;
+
+				// Create the complete controller class name prepending the namespace
+				if namespaceName {
+					if ends_with(namespaceName, "\\") {
+						let handlerClass = namespaceName . camelizedClass . handlerSuffix;
+					} else {
+						let handlerClass = namespaceName . "\\" . camelizedClass . handlerSuffix;
+					}
+				} else {
+					let handlerClass = camelizedClass . handlerSuffix;
+				}
+
+				// Only the class name is cached, the container may change between dispatches
+				let self::_handlerClasses[cacheKey] = handlerClass;
 			}
 
 			// Handlers are retrieved as shared instances from the Service Container
@@ -442,7 +456,8 @@ abstract class Dispatcher implements DispatcherInterface, InjectionAwareInterfac
 				break;
 			}
 
-			let this->_activeHandler = handler;
+			let this->_activeHandler = handler,
+				className = get_class(handler);
 
 			// Check if the params is an array
 			let params = this->_params;
@@ -460,7 +475,7 @@ abstract class Dispatcher implements DispatcherInterface, InjectionAwareInterfac
 
 			// Check if the method exists in the handler
 			let actionMethod = actionName . actionSuffix;
-			if !method_exists(handler, actionMethod) {
+			if !this->_handlerHasMethod(handler, className, actionMethod) {
 
 				// Call beforeNotFoundAction
 				if typeof eventsManager == "object" {
@@ -499,7 +514,7 @@ abstract class Dispatcher implements DispatcherInterface, InjectionAwareInterfac
 			}
 
 			// Calling beforeExecuteRoute as callback and event
-			if method_exists(handler, "beforeExecuteRoute") {
+			if this->_handlerHasMethod(handler, className, "beforeExecuteRoute") {
 
 				if handler->beforeExecuteRoute(this) === false {
 					continue;
@@ -516,7 +531,7 @@ abstract class Dispatcher implements DispatcherInterface, InjectionAwareInterfac
 			 */
 			if wasFresh === true {
 
-				if method_exists(handler, "initialize") {
+				if this->_handlerHasMethod(handler, className, "initialize") {
 					handler->initialize();
 				}
 
@@ -567,7 +582,7 @@ abstract class Dispatcher implements DispatcherInterface, InjectionAwareInterfac
 			}
 
 			// Calling afterExecuteRoute as callback and event
-			if method_exists(handler, "afterExecuteRoute") {
+			if this->_handlerHasMethod(handler, className, "afterExecuteRoute") {
 
 				if handler->afterExecuteRoute(this, value) === false {
 					continue;
@@ -645,4 +660,33 @@ abstract class Dispatcher implements DispatcherInterface, InjectionAwareInterfac
 	{
 		return this->_forwarded;
 	}
+
+	/**
+	 * Checks if a handler implements a method. Results are cached per class
+	 */
+	protected final function _handlerHasMethod(var handler, string! className, string! methodName) -> boolean
+	{
+		var handlerMethods, key, exists;
+
+		let key = className . "::" . methodName,
+			handlerMethods = self::_handlerMethods;
+
+		if fetch exists, handlerMethods[key] {
+			return exists;
+		}
+
+		let exists = method_exists(handler, methodName),
+			self::_handlerMethods[key] = exists;
+
+		return exists;
+	}
+
+	/**
+	 * Clears the cache of resolved handler classes and methods shared by all the dispatchers
+	 */
+	public static function resetHandlersCache()
+	{
+		let self::_handlerClasses = null,
+			self::_handlerMethods = null;
+	}
 }
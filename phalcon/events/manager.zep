@@ -41,6 +41,10 @@ class Manager implements ManagerInterface
 
 	protected _responses;
 
+	protected _sortedEvents;
+
+	protected _eventTypes;
+
 	/**
 	 * Attach a listener to the events manager
 	 *
@@ -77,6 +81,11 @@ class Manager implements ManagerInterface
 		// Insert the handler in the queue
 		if typeof priorityQueue == "object" {
 			priorityQueue->insert(handler, priority);
+
+			// The presorted listeners are rebuilt on the next fire
+			if isset this->_sortedEvents[eventType] {
+				unset this->_sortedEvents[eventType];
+			}
 		} else {
 			// Append the events to the queue
 			let priorityQueue[] = handler;
@@ -119,6 +128,10 @@ class Manager implements ManagerInterface
 				}
 
 				let this->_events[eventType] = newPriorityQueue;
+
+				if isset this->_sortedEvents[eventType] {
+					unset this->_sortedEvents[eventType];
+				}
 			} else {
 				let key = array_search(handler, priorityQueue, true);
 				if key !== false {
@@ -187,11 +200,15 @@ class Manager implements ManagerInterface
 	public function detachAll(string! type = null)
 	{
 		if type === null {
-			let this->_events = null;
+			let this->_events = null,
+				this->_sortedEvents = null;
 		} else {
 			if isset this->_events[type] {
 				unset this->_events[type];
 			}
+			if isset this->_sortedEvents[type] {
+				unset this->_sortedEvents[type];
+			}
 		}
 	}
 
@@ -404,13 +421,19 @@ class Manager implements ManagerInterface
 			return null;
 		}
 
-		// All valid events must have a colon separator
-		if !memstr(eventType, ":") {
-			throw new Exception("Invalid event type " . eventType);
+		// Event types are parsed only once
+		if !fetch eventParts, this->_eventTypes[eventType] {
+
+			// All valid events must have a colon separator
+			if !memstr(eventType, ":") {
+				throw new Exception("Invalid event type " . eventType);
+			}
+
+			let eventParts = explode(":", eventType),
+				this->_eventTypes[eventType] = eventParts;
 		}
 
-		let eventParts = explode(":", eventType),
-			type = eventParts[0],
+		let type = eventParts[0],
 			eventName = eventParts[1];
 
 		let status = null;
@@ -420,12 +443,23 @@ class Manager implements ManagerInterface
 			let this->_responses = null;
 		}
 
+		// Nothing to do if there are no listeners for the type or the event itself
+		if !isset events[type] {
+			if !isset events[eventType] {
+				return null;
+			}
+		}
+
 		let event = null;
 
 		// Check if events are grouped by type
 		if fetch fireEvents, events[type] {
 
-			if typeof fireEvents == "object" || typeof fireEvents == "array" {
+			if typeof fireEvents == "object" {
+				let fireEvents = this->_getSortedListeners(type, fireEvents);
+			}
+
+			if typeof fireEvents == "array" {
 
 				// Create the event context
 				let event = new Event(eventName, source, data, cancelable);
@@ -439,7 +473,11 @@ class Manager implements ManagerInterface
 		// Check if there are listeners for the event type itself
 		if fetch fireEvents, events[eventType] {
 
-			if typeof fireEvents == "object" || typeof fireEvents == "array" {
+			if typeof fireEvents == "object" {
+				let fireEvents = this->_getSortedListeners(eventType, fireEvents);
+			}
+
+			if typeof fireEvents == "array" {
 
 				// Create the event if it wasn't created before
 				if event === null {
@@ -455,6 +493,35 @@ class Manager implements ManagerInterface
 		return status;
 	}
 
+	/**
+	 * Returns the listeners in a priority queue as an array sorted by priority.
+	 * The array is built once and reused until the listeners change, avoiding
+	 * to clone the queue on every fire
+	 *
+	 * @param string eventType
+	 * @param \SplPriorityQueue priorityQueue
+	 * @return array
+	 */
+	protected function _getSortedListeners(string! eventType, var priorityQueue) -> array | boolean
+	{
+		var sorted, iterator;
+
+		if fetch sorted, this->_sortedEvents[eventType] {
+			return sorted;
+		}
+
+		if !(priorityQueue instanceof \SplPriorityQueue) {
+			return false;
+		}
+
+		// Iteration is destructive so the sorted array is extracted from a copy
+		let iterator = clone priorityQueue;
+		let sorted = iterator_to_array(iterator, false),
+			this->_sortedEvents[eventType] = sorted;
+
+		return sorted;
+	}
+
 	/**
 	 * Check whether certain type of event has listeners
 	 *
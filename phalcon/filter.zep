@@ -42,6 +42,8 @@ class Filter implements FilterInterface
 
 	protected _filters;
 
+	protected _chains;
+
 	/**
 	 * Adds a user-defined filter
 	 */
@@ -52,7 +54,11 @@ class Filter implements FilterInterface
 			throw new Exception("Filter must be an object");
 		}
 
-		let this->_filters[name] = handler;
+		/**
+		 * Compiled chains could refer to a replaced filter
+		 */
+		let this->_filters[name] = handler,
+			this->_chains = null;
 		return this;
 	}
 
@@ -61,123 +67,246 @@ class Filter implements FilterInterface
 	 */
 	public function sanitize(var value, var filters, boolean noRecursive = false)
 	{
-		var filter, arrayValue, itemKey, itemValue, sanitizedValue;
+		var chain, itemKey, itemValue, sanitizedValue;
 
 		/**
-		 * Apply an array of filters
+		 * Sets of filters are not applied to null values
 		 */
-		if typeof filters == "array" {
-			if value !== null {
-				for filter in filters {
-					/**
-					 * If the value to filter is an array we apply the filters recursively
-					 */
-					if typeof value == "array" && !noRecursive {
-						let arrayValue = [];
-						for itemKey, itemValue in value {
-							let arrayValue[itemKey] = this->_sanitize(itemValue, filter);
-						}
-						let value = arrayValue;
-					} else {
-						let value = this->_sanitize(value, filter);
-					}
-				}
-			}
-			return value;
+		if typeof filters == "array" && value === null {
+			return null;
 		}
 
+		let chain = this->compile(filters);
+
 		/**
-		 * Apply a single filter value
+		 * If the value to filter is an array we apply the filters recursively
 		 */
 		if typeof value == "array" && !noRecursive {
 			let sanitizedValue = [];
 			for itemKey, itemValue in value {
-				let sanitizedValue[itemKey] = this->_sanitize(itemValue, filters);
+				let sanitizedValue[itemKey] = this->_applyChain(itemValue, chain);
 			}
 			return sanitizedValue;
 		}
 
-		return this->_sanitize(value, filters);
+		return this->_applyChain(value, chain);
 	}
 
 	/**
-	 * Internal sanitize wrapper to filter_var
+	 * Sanitizes several fields of an array in a single call. Only the fields in the
+	 * schema that are present in the data are returned
+	 *
+	 *<code>
+	 *	$filtered = $filter->sanitizeArray($_POST, array(
+	 *		"name"  => array("trim", "striptags"),
+	 *		"email" => "email",
+	 *		"age"   => "int!"
+	 *	));
+	 *</code>
 	 */
-	protected function _sanitize(var value, string! filter)
+	public function sanitizeArray(array! data, array! schema, boolean noRecursive = false) -> array
+	{
+		var field, filters, value, sanitized;
+
+		let sanitized = [];
+		for field, filters in schema {
+			if fetch value, data[field] {
+				let sanitized[field] = this->sanitize(value, filters, noRecursive);
+			}
+		}
+
+		return sanitized;
+	}
+
+	/**
+	 * Compiles a single or set of filters into a chain of operations. Chains are
+	 * cached, so the names of the filters are resolved only once
+	 *
+	 * @param string|array filters
+	 * @return array
+	 */
+	public function compile(var filters) -> array
 	{
-		var filterObject;
+		var key, chain, filter, handler;
+
+		if typeof filters == "array" {
+			let key = join("|", filters);
+		} else {
+			if typeof filters != "string" {
+				throw new Exception("Filters must be a string or an array");
+			}
+			let key = filters,
+				filters = [filters];
+		}
+
+		if fetch chain, this->_chains[key] {
+			return chain;
+		}
 
-		if fetch filterObject, this->_filters[filter] {
+		let chain = [];
+		for filter in filters {
 
 			/**
-			 * If the filter is a closure we call it in the PHP userland
+			 * User-defined filters take precedence over the built-in ones
 			 */
-			if filterObject instanceof \Closure {
-				return call_user_func_array(filterObject, [value]);
+			if fetch handler, this->_filters[filter] {
+				let chain[] = [0, handler];
+			} else {
+				let chain[] = [this->_getFilterCode(filter), null];
 			}
-
-			return filterObject->filter(value);
 		}
 
+		let this->_chains[key] = chain;
+
+		return chain;
+	}
+
+	/**
+	 * Returns the internal code of a built-in filter
+	 */
+	protected function _getFilterCode(string! filter) -> int
+	{
 		switch filter {
 
 			case "email":
-				/**
-				 * The 'email' filter uses the filter extension
-				 */
-				return filter_var(str_replace("'", "", value), constant("FILTER_SANITIZE_EMAIL"));
+				return 1;
 
 			case "int":
-				/**
-				 * 'int' filter sanitizes a numeric input
-				 */
-				return filter_var(value, FILTER_SANITIZE_NUMBER_INT);
+				return 2;
 
 			case "int!":
-				return intval(value);
+				return 3;
 
 			case "string":
-				return filter_var(value, FILTER_SANITIZE_STRING);
+				return 4;
 
 			case "float":
-				/**
-				 * The 'float' filter uses the filter extension
-				 */
-				return filter_var(value, FILTER_SANITIZE_NUMBER_FLOAT, ["flags": FILTER_FLAG_ALLOW_FRACTION]);
+				return 5;
 
 			case "float!":
-				return doubleval(value);
+				return 6;
 
 			case "alphanum":
-				return preg_replace("/[^A-Za-z0-9]/", "", value);
+				return 7;
 
 			case "trim":
-				return trim(value);
+				return 8;
 
 			case "striptags":
-				return strip_tags(value);
+				return 9;
 
 			case "lower":
-				if function_exists("mb_strtolower") {
+				return 10;
+
+			case "upper":
+				return 11;
+		}
+
+		throw new Exception("Sanitize filter '" . filter . "' is not supported");
+	}
+
+	/**
+	 * Applies a compiled chain of filters to a single value
+	 */
+	protected function _applyChain(var value, array! chain)
+	{
+		var item, filterObject;
+
+		for item in chain {
+
+			switch item[0] {
+
+				case 0:
+					let filterObject = item[1];
+
 					/**
-					 * 'lower' checks for the mbstring extension to make a correct lowercase transformation
+					 * If the filter is a closure we call it in the PHP userland
 					 */
-					return mb_strtolower(value);
-				}
-				return strtolower(value);
+					if filterObject instanceof \Closure {
+						let value = call_user_func_array(filterObject, [value]);
+					} else {
+						let value = filterObject->filter(value);
+					}
+					break;
 
-			case "upper":
-				if function_exists("mb_strtoupper") {
+				case 1:
+					/**
+					 * The 'email' filter uses the filter extension
+					 */
+					let value = filter_var(str_replace("'", "", value), constant("FILTER_SANITIZE_EMAIL"));
+					break;
+
+				case 2:
+					/**
+					 * 'int' filter sanitizes a numeric input
+					 */
+					let value = filter_var(value, FILTER_SANITIZE_NUMBER_INT);
+					break;
+
+				case 3:
+					let value = intval(value);
+					break;
+
+				case 4:
+					let value = filter_var(value, FILTER_SANITIZE_STRING);
+					break;
+
+				case 5:
 					/**
-					 * 'upper' checks for the mbstring extension to make a correct lowercase transformation
+					 * The 'float' filter uses the filter extension
 					 */
-					return mb_strtoupper(value);
-				}
-				return strtoupper(value);
+					let value = filter_var(value, FILTER_SANITIZE_NUMBER_FLOAT, ["flags": FILTER_FLAG_ALLOW_FRACTION]);
+					break;
+
+				case 6:
+					let value = doubleval(value);
+					break;
+
+				case 7:
+					let value = preg_replace("/[^A-Za-z0-9]/", "", value);
+					break;
+
+				case 8:
+					let value = trim(value);
+					break;
+
+				case 9:
+					let value = strip_tags(value);
+					break;
 
-			default:
-				throw new Exception("Sanitize filter '" . filter . "' is not supported");
+				case 10:
+					if function_exists("mb_strtolower") {
+						/**
+						 * 'lower' checks for the mbstring extension to make a correct lowercase transformation
+						 */
+						let value = mb_strtolower(value);
+					} else {
+						let value = strtolower(value);
+					}
+					break;
+
+				case 11:
+					if function_exists("mb_strtoupper") {
+						/**
+						 * 'upper' checks for the mbstring extension to make a correct lowercase transformation
+						 */
+						let value = mb_strtoupper(value);
+					} else {
+						let value = strtoupper(value);
+					}
+					break;
+			}
 		}
+
+		return value;
+	}
+
+	/**
+	 * Internal sanitize wrapper to filter_var
+	 */
+	protected function _sanitize(var value, string! filter)
+	{
+		return this->_applyChain(value, this->compile(filter));
 	}
 
 	/**
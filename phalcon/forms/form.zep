@@ -51,6 +51,11 @@ class Form extends Injectable implements \Countable, \Iterator
 
 	protected _validation { set, get };
 
+	/**
+	 * Validation reused by isValid() when no validation was set
+	 */
+	protected _implicitValidation;
+
 	/**
 	 * Phalcon\Forms\Form constructor
 	 *
@@ -266,8 +271,9 @@ class Form extends Injectable implements \Countable, \Iterator
 	public function isValid(var data = null, var entity = null) -> boolean
 	{
 		var elements, notFailed, messages, element,
-			validators, name, preparedValidators, filters,
-			validator, validation, elementMessages;
+			validators, name, preparedValidators, filters, preparedFilters,
+			validator, validation, validationMessages, message, field,
+			elementMessages;
 
 		let elements = this->_elements;
 		if typeof elements != "array" {
@@ -300,66 +306,78 @@ class Form extends Injectable implements \Countable, \Iterator
 		}
 
 		let notFailed = true,
-			messages = [];
+			messages = [],
+			preparedValidators = [],
+			preparedFilters = [];
 
+		/**
+		 * Collect the validators and filters of every element, the validators of an
+		 * element with 'cancelOnFail' only cancel the ones of the same element
+		 */
 		for element in elements {
 
 			let validators = element->getValidators();
 			if typeof validators == "array" {
 				if count(validators) {
 
-					/**
-					 * Element's name
-					 */
 					let name = element->getName();
 
-					/**
-					 * Prepare the validators
-					 */
-					let preparedValidators = [];
-
 					for validator in validators {
-						let preparedValidators[] = [name, validator];
+						let preparedValidators[] = [name, validator, true];
 					}
 
-					let validation = this->getValidation();
-					if typeof validation == "object" {
-						if validation instanceof \Phalcon\Validation {
-							/**
-							 * Set the validators to the validation
-							 */
-							validation->setValidators(preparedValidators);
-						}
-					} else {
-						/**
-						 * Create an implicit validation
-						 */
-						let validation = new \Phalcon\Validation(preparedValidators);
-					}
-
-					/**
-					 * Get filters in the element
-					 */
 					let filters = element->getFilters();
-
-					/**
-					 * Assign the filters to the validation
-					 */
 					if typeof filters == "array" {
-						validation->setFilters(element->getName(), filters);
+						let preparedFilters[name] = filters;
 					}
+				}
+			}
+		}
 
-					/**
-					 * Perform the validation
-					 */
-					let elementMessages = validation->validate(data, entity);
-					if count(elementMessages) {
-						let messages[element->getName()] = elementMessages,
-							notFailed = false;
-					}
+		if count(preparedValidators) {
 
+			let validation = this->getValidation();
+			if typeof validation != "object" {
+				let validation = this->_implicitValidation;
+				if typeof validation != "object" {
+					let validation = new \Phalcon\Validation(),
+						this->_implicitValidation = validation;
 				}
+			}
 
+			if validation instanceof \Phalcon\Validation {
+
+				/**
+				 * Set the validators to the validation
+				 */
+				validation->setValidators(preparedValidators);
+
+				/**
+				 * Assign the filters to the validation
+				 */
+				for name, filters in preparedFilters {
+					validation->setFilters(name, filters);
+				}
+			}
+
+			/**
+			 * Perform the validation in a single pass, the messages are grouped by element
+			 */
+			let validationMessages = validation->validate(data, entity);
+			if typeof validationMessages == "object" {
+				for message in iterator(validationMessages) {
+					let field = message->getField();
+					if !fetch elementMessages, messages[field] {
+						let elementMessages = new Group(),
+							messages[field] = elementMessages;
+					}
+					elementMessages->appendMessage(message);
+				}
+				if count(messages) {
+					let notFailed = false;
+				}
+			} else {
+				let notFailed = false;
 			}
 		}
 
@@ -25,6 +25,7 @@ use Phalcon\Http\RequestInterface;
 use Phalcon\Di\InjectionAwareInterface;
 use Phalcon\Http\Request\Exception;
 use Phalcon\Http\Request\File;
+use Phalcon\Http\Request\JsonStream;
 
 /**
  * Phalcon\Http\Request
@@ -53,6 +54,12 @@ class Request implements RequestInterface, InjectionAwareInterface
 
 	protected _filter;
 
+	protected _headers;
+
+	protected _headerIndex;
+
+	protected _qualityHeaders;
+
 	/**
 	 * Sets the dependency injector
 	 */
@@ -325,19 +332,27 @@ class Request implements RequestInterface, InjectionAwareInterface
 	}
 
 	/**
-	 * Gets HTTP header from request data
+	 * Gets HTTP header from request data. Names are case-insensitive and they're looked up
+	 * in the same map returned by getHeaders()
 	 */
 	public final function getHeader(string! header) -> string
 	{
-		var value, name;
+		var value, index;
 
-		let name = strtoupper(strtr(header, "-", "_"));
+		let index = this->_headerIndex;
+		if typeof index != "array" {
+			this->getHeaders();
+			let index = this->_headerIndex;
+		}
 
-		if fetch value, _SERVER[name] {
+		if fetch value, index[strtolower(strtr(header, "_", "-"))] {
 			return value;
 		}
 
-		if fetch value, _SERVER["HTTP_" . name] {
+		/**
+		 * Other server variables (i.e. PHP_AUTH_USER) are read from $_SERVER
+		 */
+		if fetch value, _SERVER[strtoupper(strtr(header, "-", "_"))] {
 			return value;
 		}
 
@@ -434,6 +449,83 @@ class Request implements RequestInterface, InjectionAwareInterface
 		return false;
 	}
 
+	/**
+	 * Gets the HTTP raw request body as a stream. The body is kept in memory up to
+	 * memoryLimit bytes, bigger bodies are moved to a temporary file. If maxLength
+	 * is greater than zero, bodies exceeding it are rejected
+	 *
+	 *<code>
+	 *	$body = $request->getRawBodyStream(1048576, 52428800);
+	 *	while (!feof($body)) {
+	 *		$line = fgets($body);
+	 *	}
+	 *</code>
+	 *
+	 * @param int memoryLimit
+	 * @param int maxLength
+	 * @return resource
+	 */
+	public function getRawBodyStream(int memoryLimit = 2097152, int maxLength = 0)
+	{
+		var rawBody, stream, input, length;
+
+		let stream = fopen("php://temp/maxmemory:" . memoryLimit, "w+b");
+
+		let rawBody = this->_rawBody;
+		if !empty rawBody {
+			if maxLength > 0 && strlen(rawBody) > maxLength {
+				fclose(stream);
+				throw new Exception("The request body exceeds the maximum length allowed");
+			}
+			fwrite(stream, rawBody);
+		} else {
+			let input = fopen("php://input", "rb");
+			if maxLength > 0 {
+				let length = stream_copy_to_stream(input, stream, maxLength + 1);
+			} else {
+				let length = stream_copy_to_stream(input, stream);
+			}
+			fclose(input);
+
+			if maxLength > 0 && length > maxLength {
+				fclose(stream);
+				throw new Exception("The request body exceeds the maximum length allowed");
+			}
+		}
+
+		rewind(stream);
+		return stream;
+	}
+
+	/**
+	 * Gets an iterator over the elements of a JSON array sent in the request body.
+	 * Elements are decoded one at a time while the body is read
+	 *
+	 *<code>
+	 *	foreach ($request->getJsonStream() as $item) {
+	 *		echo $item->name;
+	 *	}
+	 *</code>
+	 */
+	public function getJsonStream(boolean associative = false, int chunkSize = 8192) -> <JsonStream>
+	{
+		var rawBody, stream;
+
+		/**
+		 * The body could have been read already
+		 */
+		let rawBody = this->_rawBody;
+		if !empty rawBody {
+			let stream = fopen("php://memory", "w+b");
+			fwrite(stream, rawBody);
+			rewind(stream);
+		} else {
+			let stream = fopen("php://input", "rb");
+		}
+
+		return new JsonStream(stream, associative, chunkSize);
+	}
+
 	/**
 	 * Gets active server address IP
 	 */
@@ -797,28 +889,41 @@ class Request implements RequestInterface, InjectionAwareInterface
 	}
 
 	/**
-	 * Returns the available headers in the request
+	 * Returns the available headers in the request. Headers are normalized the first
+	 * time they're requested and the same map is returned afterwards, getHeader() reads
+	 * from a lowercase index of the same snapshot
 	 */
 	public function getHeaders() -> array
 	{
-		var name, value, contentHeaders;
-		array headers;
+		var name, value, contentHeaders, headers, index;
+
+		let headers = this->_headers;
+		if typeof headers == "array" {
+			return headers;
+		}
 
-		let headers = [];
+		let headers = [],
+			index = [];
 		let contentHeaders = ["CONTENT_TYPE": true, "CONTENT_LENGTH": true];
 
 		for name, value in _SERVER {
 			if starts_with(name, "HTTP_") {
 				let name = ucwords(strtolower(str_replace("_", " ", substr(name, 5)))),
 					name = str_replace(" ", "-", name);
-				let headers[name] = value;
 			} elseif isset contentHeaders[name] {
 				let name = ucwords(strtolower(str_replace("_", " ", name))),
 					name = str_replace(" ", "-", name);
-				let headers[name] = value;
+			} else {
+				continue;
 			}
+
+			let headers[name] = value,
+				index[strtolower(name)] = value;
 		}
 
+		let this->_headers = headers,
+			this->_headerIndex = index;
+
 		return headers;
 	}
 
@@ -839,10 +944,20 @@ class Request implements RequestInterface, InjectionAwareInterface
 	 */
 	protected function _getQualityHeader(string! serverIndex, string! name) -> array
 	{
-		var returnedParts, part, headerParts, headerPart, split;
+		var returnedParts, part, headerParts, headerPart, split, rawHeader, cached;
+
+		/**
+		 * Parsed headers are reused while the raw header doesn't change
+		 */
+		let rawHeader = this->getServer(serverIndex);
+		if fetch cached, this->_qualityHeaders[serverIndex] {
+			if cached[0] === rawHeader {
+				return cached[1];
+			}
+		}
 
 		let returnedParts = [];
-		for part in preg_split("/,\\s*/", this->getServer(serverIndex), -1, PREG_SPLIT_NO_EMPTY) {
+		for part in preg_split("/,\\s*/", rawHeader, -1, PREG_SPLIT_NO_EMPTY) {
 
 			let headerParts = [];
 			for headerPart in preg_split("/\s*;\s*/", trim(part), -1, PREG_SPLIT_NO_EMPTY) {
@@ -862,6 +977,8 @@ class Request implements RequestInterface, InjectionAwareInterface
 			let returnedParts[] = headerParts;
 		}
 
+		let this->_qualityHeaders[serverIndex] = [rawHeader, returnedParts];
+
 		return returnedParts;
 	}
 
@@ -0,0 +1,315 @@
+
+/*
+ +------------------------------------------------------------------------+
+ | Phalcon Framework                                                      |
+ +------------------------------------------------------------------------+
+ | Copyright (c) 2011-2015 Phalcon Team (http://www.phalconphp.com)       |
+ +------------------------------------------------------------------------+
+ | This source file is subject to the New BSD License that is bundled     |
+ | with this package in the file docs/LICENSE.txt.                        |
+ |                                                                        |
+ | If you did not receive a copy of the license and are unable to         |
+ | obtain it through the world-wide-web, please send an email             |
+ | to license@phalconphp.com so we can send you a copy immediately.       |
+ +------------------------------------------------------------------------+
+ | Authors: Andres Gutierrez <andres@phalconphp.com>                      |
+ |          Eduar Carvajal <eduar@phalconphp.com>                         |
+ +------------------------------------------------------------------------+
+ */
+
+namespace Phalcon\Http\Request;
+
+use Phalcon\Http\Request\Exception;
+
+/**
+ * Phalcon\Http\Request\JsonStream
+ *
+ * Incremental reader of a JSON array. Top-level elements are read from the stream
+ * and decoded one at a time, so the memory used depends on the size of the biggest
+ * element rather than on the size of the whole body
+ *
+ *<code>
+ *	foreach ($request->getJsonStream(true) as $position => $item) {
+ *		$robot = new Robots();
+ *		$robot->save($item);
+ *	}
+ *</code>
+ */
+class JsonStream implements \Iterator
+{
+
+	protected _stream;
+
+	protected _associative;
+
+	protected _chunkSize;
+
+	protected _buffer = "";
+
+	protected _position = 0;
+
+	protected _current;
+
+	protected _key = -1;
+
+	protected _valid = false;
+
+	protected _started = false;
+
+	/**
+	 * Phalcon\Http\Request\JsonStream constructor
+	 *
+	 * @param resource stream
+	 * @param boolean associative
+	 * @param int chunkSize
+	 */
+	public function __construct(var stream, boolean associative = false, int chunkSize = 8192)
+	{
+		if typeof stream != "resource" {
+			throw new Exception("A valid stream is required to read JSON");
+		}
+
+		if chunkSize < 1 {
+			throw new Exception("The chunk size must be greater than zero");
+		}
+
+		let this->_stream = stream,
+			this->_associative = associative,
+			this->_chunkSize = chunkSize;
+	}
+
+	/**
+	 * Reads another chunk from the stream into the buffer, returns false at the end of the stream
+	 */
+	protected function _fill() -> boolean
+	{
+		var stream, chunk;
+
+		let stream = this->_stream;
+		if feof(stream) {
+			return false;
+		}
+
+		let chunk = fread(stream, this->_chunkSize);
+		if chunk === false || chunk === "" {
+			return !feof(stream);
+		}
+
+		let this->_buffer = this->_buffer . chunk;
+		return true;
+	}
+
+	/**
+	 * Returns the next non-whitespace character of the buffer without consuming it
+	 */
+	protected function _peek() -> string | boolean
+	{
+		var position;
+
+		loop {
+			let position = this->_position + strspn(this->_buffer, " \t\r\n", this->_position);
+			if position < strlen(this->_buffer) {
+				let this->_position = position;
+				return substr(this->_buffer, position, 1);
+			}
+
+			let this->_buffer = "",
+				this->_position = 0;
+
+			if !this->_fill() {
+				return false;
+			}
+		}
+	}
+
+	/**
+	 * Reads the raw JSON of the next top-level element or false when the array ends
+	 */
+	protected function _readElement() -> string | boolean
+	{
+		var character, position, start, element;
+		boolean inString;
+		int depth;
+
+		let character = this->_peek();
+		if character === false {
+			throw new Exception("Unexpected end of the JSON stream");
+		}
+
+		if character == "]" {
+			let this->_position++;
+			return false;
+		}
+
+		let start = this->_position,
+			position = start,
+			depth = 0,
+			inString = false;
+
+		loop {
+
+			/**
+			 * Skip the runs of characters without meaning for the structure
+			 */
+			if inString {
+				let position += strcspn(this->_buffer, "\"\\", position);
+			} else {
+				let position += strcspn(this->_buffer, "\"[]{},", position);
+			}
+
+			if position >= strlen(this->_buffer) {
+				if !this->_fill() {
+					throw new Exception("Unexpected end of the JSON stream");
+				}
+				continue;
+			}
+
+			let character = substr(this->_buffer, position, 1);
+
+			if inString {
+				if character == "\\" {
+					/**
+					 * Escaped characters need to be in the buffer before skipping them
+					 */
+					if position + 1 >= strlen(this->_buffer) {
+						if !this->_fill() {
+							throw new Exception("Unexpected end of the JSON stream");
+						}
+					}
+					let position += 2;
+				} else {
+					let inString = false,
+						position++;
+				}
+				continue;
+			}
+
+			if character == "\"" {
+				let inString = true,
+					position++;
+				continue;
+			}
+
+			if character == "[" || character == "{" {
+				let depth++,
+					position++;
+				continue;
+			}
+
+			if depth > 0 {
+				if character == "]" || character == "}" {
+					let depth--;
+				}
+				let position++;
+				continue;
+			}
+
+			/**
+			 * A comma or the closing bracket at depth zero ends the element
+			 */
+			if character == "}" {
+				throw new Exception("Malformed JSON stream");
+			}
+
+			let element = substr(this->_buffer, start, position - start);
+			if trim(element) === "" {
+				throw new Exception("Malformed JSON stream");
+			}
+
+			if character == "," {
+				let position++;
+			}
+
+			/**
+			 * Consumed data is released from the buffer
+			 */
+			let this->_buffer = (string) substr(this->_buffer, position),
+				this->_position = 0;
+
+			return element;
+		}
+	}
+
+	/**
+	 * Starts reading the stream, it can only be rewound if the stream is seekable
+	 */
+	public function rewind() -> void
+	{
+		var character;
+
+		if this->_started {
+			if !rewind(this->_stream) {
+				throw new Exception("The JSON stream cannot be rewound");
+			}
+		}
+
+		let this->_started = true,
+			this->_buffer = "",
+			this->_position = 0,
+			this->_key = -1,
+			this->_valid = false,
+			this->_current = null;
+
+		let character = this->_peek();
+		if character !== "[" {
+			throw new Exception("The JSON stream must contain an array");
+		}
+
+		let this->_position++;
+
+		this->next();
+	}
+
+	/**
+	 * Decodes the next element of the array
+	 */
+	public function next() -> void
+	{
+		var element, value;
+
+		if !this->_started {
+			this->rewind();
+			return;
+		}
+
+		let element = this->_readElement();
+		if element === false {
+			let this->_valid = false,
+				this->_current = null;
+			return;
+		}
+
+		let value = json_decode(element, this->_associative);
+		if json_last_error() {
+			throw new Exception("Malformed JSON element at position " . (this->_key + 1));
+		}
+
+		let this->_current = value,
+			this->_key++,
+			this->_valid = true;
+	}
+
+	/**
+	 * Returns the current decoded element
+	 */
+	public function current()
+	{
+		return this->_current;
+	}
+
+	/**
+	 * Returns the position of the current element
+	 */
+	public function key() -> int
+	{
+		return this->_key;
+	}
+
+	/**
+	 * Checks if there is a current element
+	 */
+	public function valid() -> boolean
+	{
+		return this->_valid;
+	}
+}
@@ -57,6 +57,18 @@ class Response implements ResponseInterface, InjectionAwareInterface
 
 	protected _file;
 
+	protected _fileRanges;
+
+	protected _fileBoundary;
+
+	protected _stream;
+
+	protected _streamJsonOptions;
+
+	protected _flushThreshold = 8192;
+
+	protected _flushBuffers = false;
+
 	protected _dependencyInjector;
 
 	protected _statusCodes;
@@ -482,7 +494,8 @@ class Response implements ResponseInterface, InjectionAwareInterface
 	 */
 	public function setContent(string content) -> <Response>
 	{
-		let this->_content = content;
+		let this->_content = content,
+			this->_stream = null;
 		return this;
 	}
 
@@ -499,7 +512,8 @@ class Response implements ResponseInterface, InjectionAwareInterface
 	 */
 	public function setJsonContent(var content, jsonOptions = 0) -> <Response>
 	{
-		let this->_content = json_encode(content, jsonOptions);
+		let this->_content = json_encode(content, jsonOptions),
+			this->_stream = null;
 		return this;
 	}
 
@@ -515,6 +529,66 @@ class Response implements ResponseInterface, InjectionAwareInterface
 		return this;
 	}
 
+	/**
+	 * Sets a body produced in chunks while the response is sent. The producer can be
+	 * an array, a Traversable object (i.e. a generator) or a callable that returns a
+	 * chunk on every call and null or false when there is nothing more to send.
+	 * Chunks are flushed to the client once they reach the flush threshold, so the
+	 * memory used doesn't depend on the size of the body. As no Content-Length is
+	 * set, the web server can use chunked transfer encoding. Output buffers opened by
+	 * the application are only flushed if 'flushBuffers' is true
+	 *
+	 *<code>
+	 *	$response->setStreamedContent(function() use ($handler) {
+	 *		$row = fgetcsv($handler);
+	 *		return $row ? implode(",", $row) . PHP_EOL : null;
+	 *	}, 65536);
+	 *</code>
+	 *
+	 * @param array|Traversable|callable producer
+	 * @param int flushThreshold
+	 * @param boolean flushBuffers
+	 * @return Phalcon\Http\Response
+	 */
+	public function setStreamedContent(var producer, int flushThreshold = 8192, boolean flushBuffers = false) -> <Response>
+	{
+		if !is_callable(producer) {
+			if typeof producer != "array" && !(producer instanceof \Traversable) {
+				throw new Exception("The producer must be an array, a Traversable object or a callable");
+			}
+		}
+
+		let this->_content = null,
+			this->_stream = producer,
+			this->_streamJsonOptions = null,
+			this->_flushThreshold = flushThreshold,
+			this->_flushBuffers = flushBuffers;
+
+		return this;
+	}
+
+	/**
+	 * Sets a body streamed as a JSON array, every element produced is encoded when
+	 * it's sent. Records of resultsets are converted using their toArray() method,
+	 * so big resultsets are encoded without building the whole array in memory
+	 *
+	 *<code>
+	 *	$response->setJsonStreamedContent(Robots::find());
+	 *</code>
+	 *
+	 * @param array|Traversable|callable producer
+	 * @param int jsonOptions
+	 * @param int flushThreshold
+	 * @param boolean flushBuffers
+	 * @return Phalcon\Http\Response
+	 */
+	public function setJsonStreamedContent(var producer, int jsonOptions = 0, int flushThreshold = 8192, boolean flushBuffers = false) -> <Response>
+	{
+		this->setStreamedContent(producer, flushThreshold, flushBuffers);
+		let this->_streamJsonOptions = jsonOptions;
+		return this;
+	}
+
 	/**
 	 * Gets the HTTP response body
 	 */
@@ -562,7 +636,7 @@ class Response implements ResponseInterface, InjectionAwareInterface
 	 */
 	public function send() -> <Response>
 	{
-		var headers, cookies, content, file;
+		var headers, cookies, content, file, ranges, stream;
 
 		if this->_sent {
 			throw new Exception("Response was already sent");
@@ -591,10 +665,22 @@ class Response implements ResponseInterface, InjectionAwareInterface
 		if content != null {
 			echo content;
 		} else {
+			let stream = this->_stream;
+			if stream !== null {
+				this->_sendStream(stream);
+				let this->_sent = true;
+				return this;
+			}
+
 			let file = this->_file;
 
 			if typeof file == "string" && strlen(file) {
-				readfile(file);
+				let ranges = this->_fileRanges;
+				if typeof ranges == "array" {
+					this->_sendFileRanges(file, ranges);
+				} else {
+					readfile(file);
+				}
 			}
 		}
 
@@ -602,16 +688,124 @@ class Response implements ResponseInterface, InjectionAwareInterface
 		return this;
 	}
 
+	/**
+	 * Outputs a streamed body flushing it every time the buffer reaches the threshold
+	 */
+	protected function _sendStream(var producer)
+	{
+		var buffer, chunk;
+		boolean first;
+
+		let first = true;
+
+		if this->_streamJsonOptions !== null {
+			let buffer = "[";
+		} else {
+			let buffer = "";
+		}
+
+		if is_callable(producer) {
+			loop {
+				let chunk = call_user_func(producer);
+				if chunk === null || chunk === false {
+					break;
+				}
+				let buffer = this->_writeChunk(buffer, chunk, first),
+					first = false;
+			}
+		} else {
+			for chunk in producer {
+				let buffer = this->_writeChunk(buffer, chunk, first),
+					first = false;
+			}
+		}
+
+		if this->_streamJsonOptions !== null {
+			let buffer .= "]";
+		}
+
+		echo buffer;
+		this->_flushOutput();
+	}
+
+	/**
+	 * Appends a chunk to the stream buffer, the buffer is sent when it reaches the threshold
+	 */
+	protected function _writeChunk(string buffer, var chunk, boolean first) -> string
+	{
+		var jsonOptions;
+
+		let jsonOptions = this->_streamJsonOptions;
+		if jsonOptions !== null {
+
+			if typeof chunk == "object" {
+				if method_exists(chunk, "toArray") {
+					let chunk = chunk->toArray();
+				}
+			}
+
+			if !first {
+				let buffer .= ",";
+			}
+
+			let buffer .= json_encode(chunk, jsonOptions);
+		} else {
+			let buffer .= chunk;
+		}
+
+		if strlen(buffer) >= this->_flushThreshold {
+			echo buffer;
+			this->_flushOutput();
+			return "";
+		}
+
+		return buffer;
+	}
+
+	/**
+	 * Pushes the output produced so far to the client, the output buffers wrapping the
+	 * application (i.e. gzip handlers) are left alone unless it was requested
+	 */
+	protected function _flushOutput()
+	{
+		if this->_flushBuffers && ob_get_level() > 0 {
+			ob_flush();
+		}
+		flush();
+	}
+
 	/**
 	 * Sets an attached file to be sent at the end of the request
 	 *
+	 * The following options are available:
+	 * - "etag": adds Etag/Last-Modified headers based on the file stats and answers
+	 *   304 when the request has a matching If-None-Match/If-Modified-Since header
+	 * - "ranges": answers single and multiple byte ranges requested by the client
+	 * - "offload": name of the header used to delegate the transfer to the web server
+	 *   ("X-Sendfile" or "X-Accel-Redirect")
+	 * - "offloadPath": value of the offload header, by default the file path
+	 *
+	 *<code>
+	 *	$response->setFileToSend("/var/files/report.pdf", "report.pdf", true, array(
+	 *		"etag"   => true,
+	 *		"ranges" => true
+	 *	));
+	 *
+	 *	$response->setFileToSend("/var/files/report.pdf", null, true, array(
+	 *		"offload"     => "X-Accel-Redirect",
+	 *		"offloadPath" => "/protected/report.pdf"
+	 *	));
+	 *</code>
+	 *
 	 * @param string filePath
 	 * @param string attachmentName
+	 * @param boolean attachment
+	 * @param array options
 	 * @return Phalcon\Http\Response
 	 */
-	public function setFileToSend(string filePath, attachmentName = null, attachment = true) -> <Response>
+	public function setFileToSend(string filePath, attachmentName = null, attachment = true, var options = null) -> <Response>
 	{
-		var basePath, headers;
+		var basePath, headers, offload, offloadPath;
 
 		if typeof attachmentName != "string" {
 			let basePath = basename(filePath);
@@ -619,17 +813,276 @@ class Response implements ResponseInterface, InjectionAwareInterface
 			let basePath = attachmentName;
 		}
 
-		if attachment {
-			let headers = this->getHeaders();
+		let headers = this->getHeaders();
 
+		if attachment {
 			headers->setRaw("Content-Description: File Transfer");
 			headers->setRaw("Content-Type: application/octet-stream");
 			headers->setRaw("Content-Disposition: attachment; filename=" . basePath);
 			headers->setRaw("Content-Transfer-Encoding: binary");
 		}
 
-		let this->_file = filePath;
+		let this->_file = filePath,
+			this->_fileRanges = null,
+			this->_fileBoundary = null;
+
+		if typeof options != "array" {
+			return this;
+		}
+
+		/**
+		 * The web server delivers the file, the worker is freed immediately
+		 */
+		if fetch offload, options["offload"] {
+			if !fetch offloadPath, options["offloadPath"] {
+				let offloadPath = filePath;
+			}
+			headers->set(offload, offloadPath);
+			let this->_file = null;
+			return this;
+		}
+
+		this->_prepareFileToSend(filePath, options, attachment);
 
 		return this;
 	}
+
+	/**
+	 * Evaluates the conditional and range headers of the request for the file to send
+	 */
+	protected function _prepareFileToSend(string! filePath, array! options, attachment)
+	{
+		var headers, size, mtime, etag, lastModified, header, ranges, range,
+			contentType, boundary, preamble, length, closing;
+		boolean notModified;
+
+		let size = filesize(filePath);
+		if size === false {
+			throw new Exception("File to send cannot be read");
+		}
+
+		let headers = this->getHeaders(),
+			etag = null,
+			lastModified = null;
+
+		if isset options["etag"] && options["etag"] {
+
+			let mtime = filemtime(filePath),
+				etag = "\"" . dechex(size) . "-" . dechex(mtime) . "\"",
+				lastModified = gmdate("D, d M Y H:i:s", mtime) . " GMT";
+
+			headers->set("Etag", etag);
+			headers->set("Last-Modified", lastModified);
+
+			/**
+			 * If-None-Match takes precedence over If-Modified-Since
+			 */
+			let notModified = false;
+			if fetch header, _SERVER["HTTP_IF_NONE_MATCH"] {
+				if trim(header) == "*" {
+					let notModified = true;
+				} else {
+					let notModified = in_array(etag, array_map("trim", explode(",", str_replace("W/", "", header))), true);
+				}
+			} else {
+				if fetch header, _SERVER["HTTP_IF_MODIFIED_SINCE"] {
+					let notModified = strtotime(header) >= mtime;
+				}
+			}
+
+			if notModified {
+				this->setNotModified();
+				let this->_file = null;
+				return;
+			}
+		}
+
+		if !isset options["ranges"] || !options["ranges"] {
+			return;
+		}
+
+		headers->set("Accept-Ranges", "bytes");
+
+		if !fetch header, _SERVER["HTTP_RANGE"] {
+			headers->set("Content-Length", size);
+			return;
+		}
+
+		/**
+		 * Ranges are ignored if the validator in If-Range doesn't match the current file
+		 */
+		if fetch range, _SERVER["HTTP_IF_RANGE"] {
+			if range !== etag && range !== lastModified {
+				headers->set("Content-Length", size);
+				return;
+			}
+		}
+
+		let ranges = this->_parseRanges(header, size);
+		if typeof ranges != "array" {
+			headers->set("Content-Length", size);
+			return;
+		}
+
+		if !count(ranges) {
+			this->setStatusCode(416);
+			headers->set("Content-Range", "bytes */" . size);
+			let this->_file = null;
+			return;
+		}
+
+		this->setStatusCode(206);
+
+		if count(ranges) == 1 {
+			let range = ranges[0];
+			headers->set("Content-Range", "bytes " . range[0] . "-" . range[1] . "/" . size);
+			headers->set("Content-Length", range[1] - range[0] + 1);
+			let this->_fileRanges = [[range[0], range[1] - range[0] + 1, null]];
+			return;
+		}
+
+		/**
+		 * Multiple ranges are sent as a multipart/byteranges body
+		 */
+		if attachment {
+			headers->remove("Content-Type: application/octet-stream");
+			let contentType = "application/octet-stream";
+		} else {
+			let contentType = headers->get("Content-Type");
+			if !contentType {
+				let contentType = "application/octet-stream";
+			}
+		}
+
+		let boundary = md5(uniqid(filePath, true)),
+			this->_fileRanges = [],
+			length = 0;
+
+		for range in ranges {
+			let preamble = "\r\n--" . boundary . "\r\nContent-Type: " . contentType . "\r\nContent-Range: bytes " . range[0] . "-" . range[1] . "/" . size . "\r\n\r\n",
+				length += strlen(preamble) + range[1] - range[0] + 1,
+				this->_fileRanges[] = [range[0], range[1] - range[0] + 1, preamble];
+		}
+
+		let closing = "\r\n--" . boundary . "--\r\n",
+			length += strlen(closing),
+			this->_fileBoundary = closing;
+
+		headers->set("Content-Type", "multipart/byteranges; boundary=" . boundary);
+		headers->set("Content-Length", length);
+	}
+
+	/**
+	 * Parses a Range header returning the satisfiable ranges. Returns false if the
+	 * header is not valid and must be ignored
+	 */
+	protected function _parseRanges(string! header, var size) -> array | boolean
+	{
+		var ranges, part, bounds, start, end;
+
+		if !starts_with(header, "bytes=") {
+			return false;
+		}
+
+		let ranges = [];
+		for part in explode(",", substr(header, 6)) {
+
+			let bounds = explode("-", trim(part), 2);
+			if count(bounds) != 2 {
+				return false;
+			}
+
+			let start = trim(bounds[0]),
+				end = trim(bounds[1]);
+
+			if start === "" {
+
+				/**
+				 * Suffix ranges request the last bytes of the file
+				 */
+				if !ctype_digit(end) {
+					return false;
+				}
+
+				let end = (int) end;
+				if end == 0 || size == 0 {
+					continue;
+				}
+
+				let start = size - end;
+				if start < 0 {
+					let start = 0;
+				}
+				let end = size - 1;
+
+			} else {
+
+				if !ctype_digit(start) {
+					return false;
+				}
+
+				let start = (int) start;
+
+				if end === "" {
+					let end = size - 1;
+				} else {
+					if !ctype_digit(end) {
+						return false;
+					}
+					let end = (int) end;
+					if end < start {
+						return false;
+					}
+					if end >= size {
+						let end = size - 1;
+					}
+				}
+
+				if start >= size {
+					continue;
+				}
+			}
+
+			let ranges[] = [start, end];
+		}
+
+		/**
+		 * Too many ranges are served as the whole file
+		 */
+		if count(ranges) > 16 {
+			return false;
+		}
+
+		return ranges;
+	}
+
+	/**
+	 * Outputs the requested ranges of a file
+	 */
+	protected function _sendFileRanges(string! file, array! ranges)
+	{
+		var handler, output, range, closing;
+
+		let handler = fopen(file, "rb");
+		if typeof handler != "resource" {
+			throw new Exception("File to send cannot be read");
+		}
+
+		let output = fopen("php://output", "wb");
+
+		for range in ranges {
+			if range[2] !== null {
+				echo range[2];
+			}
+			stream_copy_to_stream(handler, output, range[1], range[0]);
+		}
+
+		let closing = this->_fileBoundary;
+		if closing !== null {
+			echo closing;
+		}
+
+		fclose(output);
+		fclose(handler);
+	}
 }
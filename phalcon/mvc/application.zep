@@ -81,6 +81,8 @@ class Application extends Injectable
 
 	protected _implicitView = true;
 
+	protected _startedModules;
+
 	/**
 	 * Phalcon\Mvc\Application
 	 */
@@ -273,12 +275,19 @@ class Application extends Injectable
 					}
 				}
 
-				let moduleObject = <ModuleDefinitionInterface> dependencyInjector->get(className);
+				/**
+				 * Autoloaders are registered once per process, a module started by a previous
+				 * request handled in this process only registers its services again
+				 */
+				if !fetch moduleObject, this->_startedModules[moduleName] {
+					let moduleObject = <ModuleDefinitionInterface> dependencyInjector->get(className);
+					moduleObject->registerAutoloaders(dependencyInjector);
+					let this->_startedModules[moduleName] = moduleObject;
+				}
 
 				/**
 				 * 'registerAutoloaders' and 'registerServices' are automatically called
 				 */
-				moduleObject->registerAutoloaders(dependencyInjector);
 				moduleObject->registerServices(dependencyInjector);
 
 			} else {
@@ -442,4 +451,33 @@ class Application extends Injectable
 		 */
 		return response;
 	}
+
+	/**
+	 * Clears the state of the handled request so the application can handle another one
+	 * in the same process. Service definitions, routes, models metadata and parsed annotations
+	 * are kept, the instances of request scoped services are discarded.
+	 * It must be called once the response has been sent
+	 *
+	 *<code>
+	 * while ($worker->accept()) {
+	 *     $application->handle($worker->getUri())->send();
+	 *     $application->reset();
+	 * }
+	 *</code>
+	 */
+	public function reset() -> <Application>
+	{
+		var dependencyInjector;
+
+		let dependencyInjector = this->_dependencyInjector;
+		if typeof dependencyInjector != "object" {
+			throw new Exception("A dependency injection object is required to access internal services");
+		}
+
+		this->_resetRequestScope(dependencyInjector);
+
+		\Phalcon\Tag::resetInput();
+
+		return this;
+	}
 }
@@ -74,6 +74,8 @@ class Micro extends Injectable implements \ArrayAccess
 
 	protected _returnedValue;
 
+	protected _compiledMiddleware;
+
 	/**
 	* Phalcon\Mvc\Micro constructor
 	*/
@@ -582,7 +584,8 @@ class Micro extends Injectable implements \ArrayAccess
 	{
 		var dependencyInjector, eventsManager, status = null, router, matchedRoute,
 			handler, beforeHandlers, params, returnedValue, e, errorHandler,
-			afterHandlers, notFoundHandler, finishHandlers, finish, before, after;
+			afterHandlers, notFoundHandler, finishHandlers, finish, before, after,
+			middleware;
 
 		let dependencyInjector = this->_dependencyInjector;
 		if typeof dependencyInjector != "object" {
@@ -639,37 +642,37 @@ class Micro extends Injectable implements \ArrayAccess
 					}
 				}
 
-				let beforeHandlers = this->_beforeHandlers;
-				if typeof beforeHandlers == "array" {
+				let beforeHandlers = this->_getCompiledMiddleware("before");
+				if count(beforeHandlers) {
 
 					let this->_stopped = false;
 
 					/**
 					 * Calls the before handlers
 					 */
-					for before in beforeHandlers {
+					for middleware in beforeHandlers {
 
-						if typeof before == "object" {
-							if before instanceof MiddlewareInterface {
+						let before = middleware[1];
 
-								/**
-								 * Call the middleware
-								 */
-								let status = before->call(this);
+						if middleware[0] === 1 {
 
-								/**
-								 * Reload the status
-								 * break the execution if the middleware was stopped
-								 */
-								if this->_stopped {
-									break;
-								}
+							/**
+							 * Call the middleware
+							 */
+							let status = before->call(this);
 
-								continue;
+							/**
+							 * Reload the status
+							 * break the execution if the middleware was stopped
+							 */
+							if this->_stopped {
+								break;
 							}
+
+							continue;
 						}
 
-						if !is_callable(before) {
+						if middleware[0] === 2 {
 							throw new Exception("'before' handler is not callable");
 						}
 
@@ -693,7 +696,7 @@ class Micro extends Injectable implements \ArrayAccess
 				 * Calling the Handler in the PHP userland
 				 */
 				let params = router->getParams();
-				let returnedValue = call_user_func_array(handler, params);
+				let returnedValue = call_user_func_array(this->_resolveHandler(handler), params);
 
 				/**
 				 * Update the returned value
@@ -707,36 +710,36 @@ class Micro extends Injectable implements \ArrayAccess
 					eventsManager->fire("micro:afterExecuteRoute", this);
 				}
 
-				let afterHandlers = this->_afterHandlers;
-				if typeof afterHandlers == "array" {
+				let afterHandlers = this->_getCompiledMiddleware("after");
+				if count(afterHandlers) {
 
 					let this->_stopped = false;
 
 					/**
 					 * Calls the after handlers
 					 */
-					for after in afterHandlers {
+					for middleware in afterHandlers {
 
-						if typeof after == "object" {
-							if after instanceof MiddlewareInterface {
+						let after = middleware[1];
 
-								/**
-								 * Call the middleware
-								 */
-								let status = after->call(this);
+						if middleware[0] === 1 {
 
-								/**
-								 * break the execution if the middleware was stopped
-								 */
-								if this->_stopped {
-									break;
-								}
+							/**
+							 * Call the middleware
+							 */
+							let status = after->call(this);
 
-								continue;
+							/**
+							 * break the execution if the middleware was stopped
+							 */
+							if this->_stopped {
+								break;
 							}
+
+							continue;
 						}
 
-						if !is_callable(after) {
+						if middleware[0] === 2 {
 							throw new Exception("One of the 'after' handlers is not callable");
 						}
 
@@ -777,8 +780,8 @@ class Micro extends Injectable implements \ArrayAccess
 				eventsManager->fire("micro:afterHandleRoute", this, returnedValue);
 			}
 
-			let finishHandlers = this->_finishHandlers;
-			if typeof finishHandlers == "array" {
+			let finishHandlers = this->_getCompiledMiddleware("finish");
+			if count(finishHandlers) {
 
 				let this->_stopped = false;
 
@@ -787,32 +790,31 @@ class Micro extends Injectable implements \ArrayAccess
 				/**
 				 * Calls the finish handlers
 				 */
-				for finish in finishHandlers {
+				for middleware in finishHandlers {
+
+					let finish = middleware[1];
 
 					/**
 					 * Try to execute middleware as plugins
 					 */
-					if typeof finish == "object" {
-
-						if finish instanceof MiddlewareInterface {
-
-							/**
-							 * Call the middleware
-							 */
-							let status = finish->call(this);
+					if middleware[0] === 1 {
 
-							/**
-							 * break the execution if the middleware was stopped
-							 */
-							if this->_stopped {
-								break;
-							}
+						/**
+						 * Call the middleware
+						 */
+						let status = finish->call(this);
 
-							continue;
+						/**
+						 * break the execution if the middleware was stopped
+						 */
+						if this->_stopped {
+							break;
 						}
+
+						continue;
 					}
 
-					if !is_callable(finish) {
+					if middleware[0] === 2 {
 						throw new Exception("One of the 'finish' handlers is not callable");
 					}
 
@@ -988,6 +990,7 @@ class Micro extends Injectable implements \ArrayAccess
 	public function before(handler) -> <Micro>
 	{
 		let this->_beforeHandlers[] = handler;
+		let this->_compiledMiddleware = null;
 		return this;
 	}
 
@@ -1000,6 +1003,7 @@ class Micro extends Injectable implements \ArrayAccess
 	public function after(handler) -> <Micro>
 	{
 		let this->_afterHandlers[] = handler;
+		let this->_compiledMiddleware = null;
 		return this;
 	}
 
@@ -1012,6 +1016,7 @@ class Micro extends Injectable implements \ArrayAccess
 	public function finish(handler) -> <Micro>
 	{
 		let this->_finishHandlers[] = handler;
+		let this->_compiledMiddleware = null;
 		return this;
 	}
 
@@ -1024,4 +1029,116 @@ class Micro extends Injectable implements \ArrayAccess
 	{
 		return this->_handlers;
 	}
+
+	/**
+	 * Clears the state of the handled request so the application can handle another one
+	 * in the same process. Routes, handlers, middleware and service definitions are kept,
+	 * the instances of request scoped services are discarded.
+	 * It must be called once the response has been sent
+	 *
+	 *<code>
+	 * while ($worker->accept()) {
+	 *     $app->handle($worker->getUri());
+	 *     $app->reset();
+	 * }
+	 *</code>
+	 */
+	public function reset() -> <Micro>
+	{
+		var dependencyInjector;
+
+		let this->_stopped = false,
+			this->_activeHandler = null,
+			this->_returnedValue = null;
+
+		let dependencyInjector = this->_dependencyInjector;
+		if typeof dependencyInjector == "object" {
+			this->_resetRequestScope(dependencyInjector);
+		}
+
+		\Phalcon\Tag::resetInput();
+
+		return this;
+	}
+
+	/**
+	 * Returns a 'before', 'after' or 'finish' chain flattened into [kind, handler] pairs,
+	 * kind is 0 for callables, 1 for middleware objects and 2 for handlers that are not callable.
+	 * The chain is built once and kept until a new handler is appended
+	 */
+	protected function _getCompiledMiddleware(string! type) -> array
+	{
+		var compiledMiddleware, compiled, handlers, handler;
+
+		let compiledMiddleware = this->_compiledMiddleware;
+		if typeof compiledMiddleware == "array" {
+			if fetch compiled, compiledMiddleware[type] {
+				return compiled;
+			}
+		}
+
+		switch type {
+
+			case "before":
+				let handlers = this->_beforeHandlers;
+				break;
+
+			case "after":
+				let handlers = this->_afterHandlers;
+				break;
+
+			default:
+				let handlers = this->_finishHandlers;
+				break;
+		}
+
+		let compiled = [];
+		if typeof handlers == "array" {
+			for handler in handlers {
+
+				if typeof handler == "object" {
+					if handler instanceof MiddlewareInterface {
+						let compiled[] = [1, handler];
+						continue;
+					}
+				}
+
+				if !is_callable(handler) {
+					let compiled[] = [2, handler];
+					continue;
+				}
+
+				let compiled[] = [0, handler];
+			}
+		}
+
+		let this->_compiledMiddleware[type] = compiled;
+		return compiled;
+	}
+
+	/**
+	 * Replaces handlers pointing to a LazyLoader by the loaded handler, this avoids
+	 * going through LazyLoader::__call on every call
+	 *
+	 * @param callable handler
+	 * @return callable
+	 */
+	protected function _resolveHandler(var handler)
+	{
+		var lazyLoader, method;
+
+		if typeof handler == "array" {
+			if fetch lazyLoader, handler[0] {
+				if typeof lazyLoader == "object" {
+					if lazyLoader instanceof LazyLoader {
+						if fetch method, handler[1] {
+							return [lazyLoader->getHandler(), method];
+						}
+					}
+				}
+			}
+		}
+
+		return handler;
+	}
 }
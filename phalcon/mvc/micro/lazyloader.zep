@@ -47,7 +47,20 @@ class LazyLoader
 	 */
 	public function __call(string! method, arguments)
 	{
- 		var handler, definition;
+		/**
+		 * Call the handler
+		 */
+		return call_user_func_array([this->getHandler(), method], arguments);
+	}
+
+	/**
+	 * Returns the internal handler, creating it the first time it's requested
+	 *
+	 * @return object
+	 */
+	public function getHandler()
+	{
+		var handler, definition;
 
 		let handler = this->_handler;
 
@@ -57,9 +70,14 @@ class LazyLoader
 			let this->_handler = handler;
 		}
 
-		/**
-		 * Call the handler
-		 */
-		return call_user_func_array([handler, method], arguments);
+		return handler;
+	}
+
+	/**
+	 * Returns the class name of the handler
+	 */
+	public function getDefinition() -> string
+	{
+		return this->_definition;
 	}
 }
@@ -89,6 +89,10 @@ class Router implements InjectionAwareInterface,RouterInterface
 
 	protected _notFoundPaths;
 
+	protected _namedRoutes;
+
+	protected _routesById;
+
 	const URI_SOURCE_GET_URL = 0;
 
 	const URI_SOURCE_SERVER_REQUEST_URI = 1;
@@ -632,7 +636,9 @@ class Router implements InjectionAwareInterface,RouterInterface
 		 * Every route is internally stored as a Phalcon\Mvc\Router\Route
 		 */
 		let route = new Route(pattern, paths, httpMethods),
-			this->_routes[] = route;
+			this->_routes[] = route,
+			this->_namedRoutes = null,
+			this->_routesById = null;
 		return route;
 	}
 
@@ -758,6 +764,9 @@ class Router implements InjectionAwareInterface,RouterInterface
 			let this->_routes = groupRoutes;
 		}
 
+		let this->_namedRoutes = null,
+			this->_routesById = null;
+
 		return this;
 	}
 
@@ -780,7 +789,9 @@ class Router implements InjectionAwareInterface,RouterInterface
 	 */
 	public function clear()
 	{
-		let this->_routes = [];
+		let this->_routes = [],
+			this->_namedRoutes = null,
+			this->_routesById = null;
 	}
 
 	/**
@@ -862,12 +873,19 @@ class Router implements InjectionAwareInterface,RouterInterface
 	 */
 	public function getRouteById(var id) -> <Route> | boolean
 	{
-		var route;
+		var routesById, route;
 
-		for route in this->_routes {
-			if route->getRouteId() == id {
-				return route;
+		let routesById = this->_routesById;
+		if typeof routesById != "array" {
+			let routesById = [];
+			for route in this->_routes {
+				let routesById[route->getRouteId()] = route;
 			}
+			let this->_routesById = routesById;
+		}
+
+		if fetch route, routesById[id] {
+			return route;
 		}
 
 		return false;
@@ -878,16 +896,51 @@ class Router implements InjectionAwareInterface,RouterInterface
 	 */
 	public function getRouteByName(string! name) -> <Route> | boolean
 	{
-		var route;
+		var namedRoutes, route;
 
-		for route in this->_routes {
+		let namedRoutes = this->_namedRoutes;
+		if typeof namedRoutes != "array" {
+			let namedRoutes = this->_indexNamedRoutes();
+		}
+
+		if fetch route, namedRoutes[name] {
 			if route->getName() == name {
 				return route;
 			}
 		}
+
+		/**
+		 * Routes can be renamed after the index was built
+		 */
+		let namedRoutes = this->_indexNamedRoutes();
+		if fetch route, namedRoutes[name] {
+			return route;
+		}
+
 		return false;
 	}
 
+	/**
+	 * Builds the index of routes by name, the first route using a name wins
+	 */
+	protected function _indexNamedRoutes() -> array
+	{
+		var namedRoutes, route, name;
+
+		let namedRoutes = [];
+		for route in this->_routes {
+			let name = route->getName();
+			if typeof name == "string" {
+				if !isset namedRoutes[name] {
+					let namedRoutes[name] = route;
+				}
+			}
+		}
+
+		let this->_namedRoutes = namedRoutes;
+		return namedRoutes;
+	}
+
 	/**
 	 * Returns whether controller name should not be mangled
 	 */
@@ -41,6 +41,14 @@ use Phalcon\Mvc\Router\Exception;
  * 		return $router;
  *	};
  *</code>
+ *
+ * The routes read from the annotations can be stored in a cache backend, later requests
+ * add them to the router without reading any annotation. An entry is rebuilt when the
+ * contents of one of the controller files change, each file is hashed at most once per process
+ *
+ *<code>
+ *	$router->setRoutesCache(new \Phalcon\Cache\Backend\Apc(new \Phalcon\Cache\Frontend\Data()));
+ *</code>
  */
 class Annotations extends Router
 {
@@ -54,6 +62,16 @@ class Annotations extends Router
 
 	protected _routePrefix;
 
+	protected _routesCache;
+
+	protected _routesCacheKey;
+
+	protected static _fileHashes;
+
+	protected _collectRoutes = false;
+
+	protected _routeDefinitions;
+
 	/**
 	 * Adds a resource to the annotations handler
 	 * A resource is a class that contains routing annotations
@@ -78,16 +96,30 @@ class Annotations extends Router
 		return this;
 	}
 
+	/**
+	 * Sets a cache backend where the routes read from the annotations are stored
+	 */
+	public function setRoutesCache(<\Phalcon\Cache\BackendInterface> cache, string! key = null) -> <Annotations>
+	{
+		let this->_routesCache = cache,
+			this->_routesCacheKey = key;
+		return this;
+	}
+
+	/**
+	 * Returns the cache backend used to store the routes
+	 */
+	public function getRoutesCache() -> <\Phalcon\Cache\BackendInterface>
+	{
+		return this->_routesCache;
+	}
+
 	/**
 	 * Produce the routing parameters from the rewrite information
 	 */
 	public function handle(string! uri = null)
 	{
-		var realUri, annotationsService, handlers, controllerSuffix,
-			scope, prefix, dependencyInjector, handler, controllerName,
-			lowerControllerName, namespaceName, moduleName, sufixed, handlerAnnotations,
-			classAnnotations, annotations, annotation, methodAnnotations, lowercased, method,
-			collection;
+		var realUri, annotationsService, handlers, scope, prefix, table, resource, definition;
 
 		if !uri {
 			/**
@@ -100,120 +132,299 @@ class Annotations extends Router
 
 		if !this->_processed {
 
-			let annotationsService = null;
+			if typeof this->_routesCache == "object" {
 
-			let handlers = this->_handlers;
-			if typeof handlers == "array" {
+				/**
+				 * The route table contains the routes of every resource, only the resources
+				 * whose prefix matches the uri are added to the router
+				 */
+				let table = this->getRouteTable();
+				for resource in table["resources"] {
 
-				let controllerSuffix = this->_controllerSuffix;
+					let prefix = resource[0];
+					if !empty prefix {
+						if !starts_with(realUri, prefix) {
+							continue;
+						}
+					}
+
+					for definition in resource[1] {
+						this->_addRouteDefinition(definition);
+					}
+				}
 
-				for scope in handlers {
+			} else {
 
-					if typeof scope == "array" {
+				let annotationsService = null;
 
-						/**
-						 * A prefix (if any) must be in position 0
-						 */
-						let prefix = scope[0];
+				let handlers = this->_handlers;
+				if typeof handlers == "array" {
 
-						if !empty prefix {
-							if !starts_with(realUri, prefix) {
-								continue;
-							}
-						}
+					for scope in handlers {
+
+						if typeof scope == "array" {
+
+							/**
+							 * A prefix (if any) must be in position 0
+							 */
+							let prefix = scope[0];
 
-						if typeof annotationsService != "object" {
+							if !empty prefix {
+								if !starts_with(realUri, prefix) {
+									continue;
+								}
+							}
 
-							let dependencyInjector = <DiInterface> this->_dependencyInjector;
-							if typeof dependencyInjector != "object" {
-								throw new Exception("A dependency injection container is required to access the 'annotations' service");
+							if typeof annotationsService != "object" {
+								let annotationsService = this->_getAnnotationsService();
 							}
 
-							let annotationsService = dependencyInjector->getShared("annotations");
+							this->_processResource(annotationsService, scope);
 						}
+					}
+				}
+			}
 
-						/**
-						 * The controller must be in position 1
-						 */
-						let handler = scope[1];
+			let this->_processed = true;
+		}
 
-						if memstr(handler, "\\") {
+		/**
+		 * Call the parent handle method()
+		 */
+		parent::handle(realUri);
+	}
 
-							/**
-							 * Extract the real class name from the namespaced class
-							 * The lowercased class name is used as controller
-							 * Extract the namespace from the namespaced class
-							 */
-							let controllerName = get_class_ns(handler),
-								lowerControllerName = uncamelize(controllerName),
-								namespaceName = get_ns_class(handler);
-
-						} else {
-							let controllerName = handler,
-								lowerControllerName = uncamelize(controllerName),
-								namespaceName = null;
+	/**
+	 * Returns the routes of all the resources as plain arrays grouped by resource prefix.
+	 * The table is read from the routes cache when it's still valid, otherwise it's built
+	 * from the annotations and stored in the cache
+	 *
+	 * @return array
+	 */
+	public function getRouteTable() -> array
+	{
+		var cache, key, table, files, path, hash, valid, annotationsService,
+			handlers, scope, resources, reflection;
+
+		let cache = this->_routesCache,
+			key = this->_routesCacheKey;
+
+		if key === null {
+			let key = "_PHRA" . md5(serialize([this->_handlers, this->_controllerSuffix, this->_actionSuffix]));
+		}
+
+		if typeof cache == "object" {
+
+			let table = cache->get(key);
+			if typeof table == "array" {
+
+				/**
+				 * The table is valid while the controller files keep the same contents
+				 */
+				let valid = true;
+				if fetch files, table["files"] {
+					for path, hash in files {
+						if this->_getFileHash(path) !== hash {
+							let valid = false;
+							break;
 						}
+					}
+				}
 
-						let this->_routePrefix = null;
+				if valid {
+					return table;
+				}
+			}
+		}
 
-						/**
-						 * Check if the scope has a module associated
-						 */
-						fetch moduleName, scope[2];
+		let resources = [],
+			files = [];
 
-						let sufixed = handler . controllerSuffix;
+		let handlers = this->_handlers;
+		if typeof handlers == "array" {
 
-						/**
-						 * Get the annotations from the class
-						 */
-						let handlerAnnotations = annotationsService->get(sufixed);
+			let annotationsService = this->_getAnnotationsService();
 
-						/**
-						 * Process class annotations
-						 */
-						if typeof handlerAnnotations == "object" {
+			for scope in handlers {
 
-							let classAnnotations = handlerAnnotations->getClassAnnotations();
-							if typeof classAnnotations == "object" {
+				if typeof scope != "array" {
+					continue;
+				}
 
-								/**
-								 * Process class annotations
-								 */
-								let annotations = classAnnotations->getAnnotations();
-								if typeof annotations == "array" {
-									for annotation in annotations {
-										this->processControllerAnnotation(controllerName, annotation);
-									}
-								}
-							}
+				let this->_routeDefinitions = [],
+					this->_collectRoutes = true;
 
-							/**
-							 * Process method annotations
-							 */
-							let methodAnnotations = handlerAnnotations->getMethodsAnnotations();
-							if typeof methodAnnotations == "array" {
-								let lowercased = uncamelize(handler);
-								for method, collection in methodAnnotations {
-									if typeof collection == "object" {
-										for annotation in collection->getAnnotations() {
-											this->processActionAnnotation(moduleName, namespaceName, lowerControllerName, method, annotation);
-										}
-									}
-								}
-							}
-						}
+				this->_processResource(annotationsService, scope);
 
+				let this->_collectRoutes = false,
+					resources[] = [scope[0], this->_routeDefinitions];
+
+				if class_exists(scope[1] . this->_controllerSuffix) {
+					let reflection = new \ReflectionClass(scope[1] . this->_controllerSuffix),
+						path = reflection->getFileName();
+					if typeof path == "string" {
+						let hash = md5_file(path),
+							files[path] = hash,
+							self::_fileHashes[path] = hash;
 					}
 				}
 			}
+		}
 
-			let this->_processed = true;
+		let this->_routeDefinitions = null;
+
+		let table = ["files": files, "resources": resources];
+
+		if typeof cache == "object" {
+			cache->save(key, table);
 		}
 
+		return table;
+	}
+
+	/**
+	 * Returns the hash of a controller file computing it only the first time the file is checked in the process
+	 */
+	protected function _getFileHash(string path)
+	{
+		var hashes, hash;
+
+		let hashes = self::_fileHashes;
+		if fetch hash, hashes[path] {
+			return hash;
+		}
+
+		if file_exists(path) {
+			let hash = md5_file(path);
+		} else {
+			let hash = false;
+		}
+
+		let self::_fileHashes[path] = hash;
+
+		return hash;
+	}
+
+	/**
+	 * Returns the annotations service from the DI
+	 */
+	protected function _getAnnotationsService()
+	{
+		var dependencyInjector;
+
+		let dependencyInjector = <DiInterface> this->_dependencyInjector;
+		if typeof dependencyInjector != "object" {
+			throw new Exception("A dependency injection container is required to access the 'annotations' service");
+		}
+
+		return dependencyInjector->getShared("annotations");
+	}
+
+	/**
+	 * Reads the annotations of a resource adding its routes
+	 */
+	protected function _processResource(var annotationsService, array! scope)
+	{
+		var handler, controllerName, lowerControllerName, namespaceName, moduleName, sufixed,
+			handlerAnnotations, classAnnotations, annotations, annotation, methodAnnotations,
+			method, collection;
+
 		/**
-		 * Call the parent handle method()
+		 * The controller must be in position 1
 		 */
-		parent::handle(realUri);
+		let handler = scope[1];
+
+		if memstr(handler, "\\") {
+
+			/**
+			 * Extract the real class name from the namespaced class
+			 * The lowercased class name is used as controller
+			 * Extract the namespace from the namespaced class
+			 */
+			let controllerName = get_class_ns(handler),
+				lowerControllerName = uncamelize(controllerName),
+				namespaceName = get_ns_class(handler);
+
+		} else {
+			let controllerName = handler,
+				lowerControllerName = uncamelize(controllerName),
+				namespaceName = null;
+		}
+
+		let this->_routePrefix = null;
+
+		/**
+		 * Check if the scope has a module associated
+		 */
+		fetch moduleName, scope[2];
+
+		let sufixed = handler . this->_controllerSuffix;
+
+		/**
+		 * Get the annotations from the class
+		 */
+		let handlerAnnotations = annotationsService->get(sufixed);
+
+		/**
+		 * Process class annotations
+		 */
+		if typeof handlerAnnotations == "object" {
+
+			let classAnnotations = handlerAnnotations->getClassAnnotations();
+			if typeof classAnnotations == "object" {
+
+				/**
+				 * Process class annotations
+				 */
+				let annotations = classAnnotations->getAnnotations();
+				if typeof annotations == "array" {
+					for annotation in annotations {
+						this->processControllerAnnotation(controllerName, annotation);
+					}
+				}
+			}
+
+			/**
+			 * Process method annotations
+			 */
+			let methodAnnotations = handlerAnnotations->getMethodsAnnotations();
+			if typeof methodAnnotations == "array" {
+				for method, collection in methodAnnotations {
+					if typeof collection == "object" {
+						for annotation in collection->getAnnotations() {
+							this->processActionAnnotation(moduleName, namespaceName, lowerControllerName, method, annotation);
+						}
+					}
+				}
+			}
+		}
+	}
+
+	/**
+	 * Adds a route described as [pattern, paths, methods, converters, name] to the router
+	 */
+	protected function _addRouteDefinition(array! definition)
+	{
+		var route, methods, converters, param, converter, routeName;
+
+		let route = this->add(definition[0], definition[1]);
+
+		let methods = definition[2];
+		if methods !== null {
+			route->via(methods);
+		}
+
+		let converters = definition[3];
+		for param, converter in converters {
+			route->convert(param, converter);
+		}
+
+		let routeName = definition[4];
+		if routeName !== null {
+			route->setName(routeName);
+		}
+
+		return route;
 	}
 
 	/**
@@ -242,7 +453,7 @@ class Annotations extends Router
 		<Annotation> annotation)
 	{
 		var isRoute, name, actionName, routePrefix, paths, value, uri,
-			route, methods, converts, param, convert, conversorParam, routeName;
+			methods, converts, converters, param, convert, conversorParam, routeName, definition;
 
 		let isRoute = false, methods = null;
 
@@ -316,34 +527,24 @@ class Annotations extends Router
 				let uri = routePrefix . actionName;
 			}
 
-			/**
-			 * Add the route to the router
-			 */
-			let route = this->add(uri, paths);
-
 			/**
 			 * Add HTTP constraint methods
 			 */
-			if methods !== null {
-				route->via(methods);
-			} else {
+			if methods === null {
 				let methods = annotation->getNamedArgument("methods");
-				if typeof methods == "array" {
-					route->via(methods);
-				} else {
-					if typeof methods == "string" {
-						route->via(methods);
-					}
+				if typeof methods != "array" && typeof methods != "string" {
+					let methods = null;
 				}
 			}
 
 			/**
 			 * Add the converters
 			 */
+			let converters = [];
 			let converts = annotation->getNamedArgument("converts");
 			if typeof converts == "array" {
 				for param, convert in converts {
-					route->convert(param, convert);
+					let converters[param] = convert;
 				}
 			}
 
@@ -353,13 +554,24 @@ class Annotations extends Router
 			let converts = annotation->getNamedArgument("conversors");
 			if typeof converts == "array" {
 				for conversorParam, convert in converts {
-					route->convert(conversorParam, convert);
+					let converters[conversorParam] = convert;
 				}
 			}
 
 			let routeName = annotation->getNamedArgument("name");
-			if typeof routeName == "string" {
-				route->setName(routeName);
+			if typeof routeName != "string" {
+				let routeName = null;
+			}
+
+			let definition = [uri, paths, methods, converters, routeName];
+
+			/**
+			 * Building the route table only collects the route
+			 */
+			if this->_collectRoutes {
+				let this->_routeDefinitions[] = definition;
+			} else {
+				this->_addRouteDefinition(definition);
 			}
 
 			return true;
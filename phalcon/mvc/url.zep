@@ -54,6 +54,8 @@ class Url implements UrlInterface, InjectionAwareInterface
 
 	protected _router;
 
+	protected _compiledRoutes;
+
 	/**
 	 * Sets the DependencyInjector container
 	 */
@@ -178,7 +180,7 @@ class Url implements UrlInterface, InjectionAwareInterface
 	 */
 	public function get(var uri = null, args = null, boolean local = null)
 	{
-		var baseUri, router, dependencyInjector, routeName, route, matched, queryString;
+		var baseUri, routeName, route, matched, queryString;
 
 		if local == null {
 			if typeof uri == "string" && strstr(uri, ":") {
@@ -201,34 +203,12 @@ class Url implements UrlInterface, InjectionAwareInterface
 				throw new Exception("It's necessary to define the route name with the parameter 'for'");
 			}
 
-			let router =  <RouterInterface> this->_router;
-
-			/**
-			 * Check if the router has not previously set
-			 */
-			if typeof router != "object" {
-
-				let dependencyInjector = <DiInterface> this->_dependencyInjector;
-				if typeof dependencyInjector != "object" {
-					throw new Exception("A dependency injector container is required to obtain the 'router' service");
-				}
-
-				let router = <RouterInterface> dependencyInjector->getShared("router"),
-					this->_router = router;
-			}
-
-			/**
-			 * Every route is uniquely differenced by a name
-			 */
-			let route = <RouteInterface> router->getRouteByName(routeName);
-			if typeof route != "object" {
-				throw new Exception("Cannot obtain a route using the name '" . routeName . "'");
-			}
+			let route = this->_getNamedRoute(routeName);
 
 			/**
 			 * Replace the patterns by its variables
 			 */
-			let uri = phalcon_replace_paths(route->getPattern(), route->getReversedPaths(), uri);
+			let uri = this->_generate(route, uri);
 		}
 
 		if local {
@@ -254,6 +234,167 @@ class Url implements UrlInterface, InjectionAwareInterface
 		return uri;
 	}
 
+	/**
+	 * Generates the URLs of a named route for several sets of parameters, the route
+	 * is looked up and compiled once
+	 *
+	 *<code>
+	 * $urls = $url->getMany('show-product', array(
+	 *     array('id' => 10, 'slug' => 'red-chair'),
+	 *     array('id' => 11, 'slug' => 'blue-chair')
+	 * ));
+	 *</code>
+	 */
+	public function getMany(string! routeName, array! parametersList, boolean local = true) -> array
+	{
+		var route, baseUri, urls, key, parameters, uri;
+
+		let route = this->_getNamedRoute(routeName),
+			baseUri = this->getBaseUri(),
+			urls = [];
+
+		for key, parameters in parametersList {
+
+			if typeof parameters != "array" {
+				throw new Exception("The parameters of every URL must be an array");
+			}
+
+			let uri = this->_generate(route, parameters);
+
+			if local {
+				if ((substr(baseUri, -1) == "/") && (substr(uri, 0, 1) == "/")) {
+					let uri = baseUri . substr(uri, 1);
+				}
+				else {
+					let uri = baseUri . uri;
+				}
+			}
+
+			let urls[key] = uri;
+		}
+
+		return urls;
+	}
+
+	/**
+	 * Returns a route from the router by its name
+	 */
+	protected function _getNamedRoute(string! routeName) -> <RouteInterface>
+	{
+		var router, dependencyInjector, route;
+
+		let router =  <RouterInterface> this->_router;
+
+		/**
+		 * Check if the router has not previously set
+		 */
+		if typeof router != "object" {
+
+			let dependencyInjector = <DiInterface> this->_dependencyInjector;
+			if typeof dependencyInjector != "object" {
+				throw new Exception("A dependency injector container is required to obtain the 'router' service");
+			}
+
+			let router = <RouterInterface> dependencyInjector->getShared("router"),
+				this->_router = router;
+		}
+
+		/**
+		 * Every route is uniquely differenced by a name
+		 */
+		let route = <RouteInterface> router->getRouteByName(routeName);
+		if typeof route != "object" {
+			throw new Exception("Cannot obtain a route using the name '" . routeName . "'");
+		}
+
+		return route;
+	}
+
+	/**
+	 * Replaces the placeholders of a route by the passed values. The pattern is parsed
+	 * once per route into static segments and placeholder slots, building the URI is
+	 * a concatenation afterwards
+	 */
+	protected function _generate(<RouteInterface> route, array! replacements) -> string
+	{
+		var routeId, pattern, template, statics, slots, uri, position, key, value;
+		int next;
+
+		let routeId = route->getRouteId(),
+			pattern = route->getPattern();
+
+		if !fetch template, this->_compiledRoutes[routeId] {
+			let template = this->_compileRoute(route);
+		} else {
+			if template[0] !== pattern {
+				let template = this->_compileRoute(route);
+			}
+		}
+
+		let statics = template[1],
+			slots = template[2],
+			uri = statics[0];
+
+		for position, key in slots {
+			if fetch value, replacements[key] {
+				let uri .= value;
+			}
+			let next = position + 1,
+				uri .= statics[next];
+		}
+
+		return uri;
+	}
+
+	/**
+	 * Compiles the pattern of a route into [pattern, static segments, placeholder slots].
+	 * The pattern goes through phalcon_replace_paths once with markers as values so the
+	 * template reproduces exactly what the function would generate
+	 */
+	protected function _compileRoute(<RouteInterface> route) -> array
+	{
+		var pattern, reversedPaths, markers, names, name, marked, pieces, position, piece,
+			statics, slots, template;
+		int index;
+
+		let pattern = route->getPattern(),
+			reversedPaths = route->getReversedPaths(),
+			markers = [],
+			names = [];
+
+		for name in reversedPaths {
+			if typeof name == "string" {
+				if !isset markers[name] {
+					let markers[name] = chr(1) . count(names) . chr(1),
+						names[] = name;
+				}
+			}
+		}
+
+		let marked = phalcon_replace_paths(pattern, reversedPaths, markers);
+		if typeof marked != "string" {
+			let marked = "";
+		}
+
+		let pieces = explode(chr(1), marked),
+			statics = [],
+			slots = [];
+
+		for position, piece in pieces {
+			if position % 2 == 0 {
+				let statics[] = piece;
+			} else {
+				let index = (int) piece,
+					slots[] = names[index];
+			}
+		}
+
+		let template = [pattern, statics, slots],
+			this->_compiledRoutes[route->getRouteId()] = template;
+
+		return template;
+	}
+
 	/**
 	 * Generates a URL for a static resource
 	 *
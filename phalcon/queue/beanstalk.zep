@@ -35,14 +35,27 @@ class Beanstalk
 
 	protected _parameters;
 
+	protected _serializer = "php";
+
 	/**
 	 * Phalcon\Queue\Beanstalk
 	 *
+	 * The option "serializer" controls how job bodies are encoded: "php" (default),
+	 * "raw", "json", "igbinary", "msgpack" or an array with the callables "serialize"
+	 * and "unserialize"
+	 *
+	 *<code>
+	 * $queue = new Phalcon\Queue\Beanstalk([
+	 *     "host"       => "127.0.0.1",
+	 *     "serializer" => "json"
+	 * ]);
+	 *</code>
+	 *
 	 * @param array options
 	 */
 	public function __construct(var options = null)
 	{
-		var parameters;
+		var parameters, serializer;
 
 		if typeof options != "array" {
 			let parameters = [];
@@ -58,9 +71,136 @@ class Beanstalk
 			let parameters["port"] = 11300;
 		}
 
+		if fetch serializer, parameters["serializer"] {
+			this->setSerializer(serializer);
+		}
+
 		let this->_parameters = parameters;
 	}
 
+	/**
+	 * Sets the serializer used to encode and decode job bodies
+	 *
+	 * @param string|array serializer
+	 */
+	public function setSerializer(var serializer) -> <Beanstalk>
+	{
+		var encoder, decoder;
+
+		if typeof serializer == "array" {
+
+			if !fetch encoder, serializer["serialize"] {
+				throw new \Phalcon\Exception("Custom serializers require a 'serialize' callable");
+			}
+
+			if !fetch decoder, serializer["unserialize"] {
+				throw new \Phalcon\Exception("Custom serializers require an 'unserialize' callable");
+			}
+
+			if !is_callable(encoder) || !is_callable(decoder) {
+				throw new \Phalcon\Exception("Custom serializers must be callable");
+			}
+
+		} else {
+
+			switch serializer {
+
+				case "php":
+				case "raw":
+				case "json":
+					break;
+
+				case "igbinary":
+					if !function_exists("igbinary_serialize") {
+						throw new \Phalcon\Exception("The igbinary extension is required by the serializer");
+					}
+					break;
+
+				case "msgpack":
+					if !function_exists("msgpack_pack") {
+						throw new \Phalcon\Exception("The msgpack extension is required by the serializer");
+					}
+					break;
+
+				default:
+					throw new \Phalcon\Exception("Unknown serializer for jobs");
+			}
+		}
+
+		let this->_serializer = serializer;
+		return this;
+	}
+
+	/**
+	 * Returns the serializer used to encode and decode job bodies
+	 *
+	 * @return string|array
+	 */
+	public function getSerializer()
+	{
+		return this->_serializer;
+	}
+
+	/**
+	 * Encodes the data of a job according to the serializer
+	 */
+	public function encode(var data) -> string
+	{
+		var serializer;
+
+		let serializer = this->_serializer;
+		if typeof serializer == "array" {
+			return call_user_func(serializer["serialize"], data);
+		}
+
+		switch serializer {
+
+			case "raw":
+				return (string) data;
+
+			case "json":
+				return json_encode(data);
+
+			case "igbinary":
+				return igbinary_serialize(data);
+
+			case "msgpack":
+				return msgpack_pack(data);
+		}
+
+		return serialize(data);
+	}
+
+	/**
+	 * Decodes the body of a job according to the serializer
+	 */
+	public function decode(string body)
+	{
+		var serializer;
+
+		let serializer = this->_serializer;
+		if typeof serializer == "array" {
+			return call_user_func(serializer["unserialize"], body);
+		}
+
+		switch serializer {
+
+			case "raw":
+				return body;
+
+			case "json":
+				return json_decode(body, true);
+
+			case "igbinary":
+				return igbinary_unserialize(body);
+
+			case "msgpack":
+				return msgpack_unpack(body);
+		}
+
+		return unserialize(body);
+	}
+
 	/**
 	 * Makes a connection to the Beanstalkd server
 	 */
@@ -95,47 +235,148 @@ class Beanstalk
 	 */
 	public function put(var data, var options = null) -> string|boolean
 	{
- 		var priority, delay, ttr, serialized, response, status, length;
-
 		/**
-		 * Priority is 100 by default
+		 * The command and the body are sent in a single packet
 		 */
-		if !fetch priority, options["priority"] {
-			let priority = "100";
+		this->write(this->_buildPut(data, options));
+
+		return this->_readPutStatus();
+	}
+
+	/**
+	 * Inserts many jobs into the queue in a single round-trip. All the commands are
+	 * written in one buffer and the responses are read afterwards. Every job is an
+	 * array with the key "data" and optionally the key "options", which are merged
+	 * over the options passed to the method. The returned array preserves the keys
+	 * of the passed jobs and contains the id of every job or false on failure
+	 *
+	 *<code>
+	 * $ids = $queue->putMany([
+	 *     ["data" => ["processVideo" => 4871]],
+	 *     ["data" => ["processVideo" => 4872], "options" => ["priority" => 250]]
+	 * ], ["ttr" => 3600]);
+	 *</code>
+	 *
+	 * @param array jobs
+	 * @param array options
+	 */
+	public function putMany(array! jobs, var options = null) -> array
+	{
+		var key, job, data, jobOptions, packets, packet, chunk, results;
+		int chunkSize;
+
+		if !count(jobs) {
+			return [];
 		}
 
-		if !fetch delay, options["delay"] {
-			let delay = "0";
+		if typeof options != "array" {
+			let options = [];
 		}
 
-		if !fetch ttr, options["ttr"] {
-			let ttr = "86400";
+		let packets = [];
+		for key, job in jobs {
+
+			if typeof job != "array" {
+				throw new \Phalcon\Exception("Every job must be an array with the key 'data'");
+			}
+
+			if !fetch data, job["data"] {
+				throw new \Phalcon\Exception("Every job must be an array with the key 'data'");
+			}
+
+			if fetch jobOptions, job["options"] {
+				if typeof jobOptions != "array" {
+					throw new \Phalcon\Exception("Job options must be an array");
+				}
+				let jobOptions = array_merge(options, jobOptions);
+			} else {
+				let jobOptions = options;
+			}
+
+			let packets[key] = this->_buildPut(data, jobOptions);
 		}
 
 		/**
-		 * Data is automatically serialized before be sent to the server
+		 * The commands are pipelined in chunks of about 64 KB, the responses of a chunk are
+		 * read before sending the next one so neither the server nor the client block
+		 * with full socket buffers
 		 */
-		let serialized = serialize(data);
+		let results = [],
+			chunk = [],
+			chunkSize = 0;
+
+		for key, packet in packets {
+			let chunk[key] = packet,
+				chunkSize += strlen(packet);
+			if chunkSize >= 65536 {
+				let results = results + this->_putChunk(chunk),
+					chunk = [],
+					chunkSize = 0;
+			}
+		}
+
+		if count(chunk) {
+			let results = results + this->_putChunk(chunk);
+		}
+
+		return results;
+	}
+
+	/**
+	 * Reserves jobs in a loop passing every one of them to the callback. The loop
+	 * stops when the callback returns false, when no job is reserved before the timeout
+	 * expires or when the limit of jobs is reached. Returns the number of processed jobs
+	 *
+	 *<code>
+	 * $queue->reserveLoop(function($job) {
+	 *     processVideo($job->getBody());
+	 *     $job->delete();
+	 * }, 5, 1000);
+	 *</code>
+	 *
+	 * @param callable callback
+	 * @param int timeout
+	 * @param int limit
+	 */
+	public function reserveLoop(var callback, var timeout = null, int limit = 0) -> int
+	{
+		var command, job;
+		int processed = 0;
+
+		if !is_callable(callback) {
+			throw new \Phalcon\Exception("The callback must be callable");
+		}
 
 		/**
-		 * Create the command
+		 * The command is built only once for the whole loop
 		 */
-		let length = strlen(serialized);
-		this->write("put " . priority . " " . delay . " " . ttr ." " . length);
-		this->write(serialized);
+		if typeof timeout != "null" {
+			let command = "reserve-with-timeout " . timeout;
+		} else {
+			let command = "reserve";
+		}
 
-		let response = this->readStatus();
-		let status = response[0];
+		loop {
 
-		if status == "INSERTED" {
-			return response[1];
-		}
+			if limit > 0 && processed >= limit {
+				break;
+			}
 
-		if status == "BURIED" {
-			return response[1];
+			this->write(command);
+
+			let job = this->_readJob("RESERVED");
+			if typeof job != "object" {
+				break;
+			}
+
+			let processed++;
+
+			if call_user_func(callback, job) === false {
+				break;
+			}
 		}
 
-		return false;
+		return processed;
 	}
 
 	/**
@@ -143,7 +384,7 @@ class Beanstalk
 	 */
 	public function reserve(var timeout = null) -> boolean|<Job>
 	{
- 		var command, response;
+ 		var command;
 
 		if typeof timeout != "null" {
 			let command = "reserve-with-timeout " . timeout;
@@ -153,19 +394,7 @@ class Beanstalk
 
 		this->write(command);
 
-		let response = this->readStatus();
-		if response[0] == "RESERVED" {
-
-			/**
-			 * The job is in the first position
-			 * Next is the job length
-			 * The body is serialized
-			 * Create a beanstalk job abstraction
-			 */
-			return new Job(this, response[1], unserialize(this->read(response[2])));
-		}
-
-		return false;
+		return this->_readJob("RESERVED");
 	}
 
 	/**
@@ -207,30 +436,115 @@ class Beanstalk
 	 */
 	public function peekReady() -> boolean|<Job>
 	{
- 		var response;
-
 		this->write("peek-ready");
 
+		return this->_readJob("FOUND");
+	}
+
+	/**
+	 * Return the next job in the list of buried jobs
+	 */
+	public function peekBuried() -> boolean|<Job>
+	{
+		this->write("peek-buried");
+
+		return this->_readJob("FOUND");
+	}
+
+	/**
+	 * Builds the "put" command followed by the serialized body
+	 */
+	protected function _buildPut(var data, var options) -> string
+	{
+ 		var priority, delay, ttr, serialized;
+
+		/**
+		 * Priority is 100 by default
+		 */
+		if !fetch priority, options["priority"] {
+			let priority = "100";
+		}
+
+		if !fetch delay, options["delay"] {
+			let delay = "0";
+		}
+
+		if !fetch ttr, options["ttr"] {
+			let ttr = "86400";
+		}
+
+		/**
+		 * Data is automatically serialized before be sent to the server
+		 */
+		let serialized = this->encode(data);
+
+		return "put " . priority . " " . delay . " " . ttr . " " . strlen(serialized) . "\r\n" . serialized;
+	}
+
+	/**
+	 * Sends a chunk of "put" commands at once and reads their responses in order
+	 */
+	protected function _putChunk(array! packets) -> array
+	{
+		var key, results;
+
+		let results = [];
+
+		if !this->write(join("\r\n", packets)) {
+			for key in array_keys(packets) {
+				let results[key] = false;
+			}
+			return results;
+		}
+
+		for key in array_keys(packets) {
+			let results[key] = this->_readPutStatus();
+		}
+
+		return results;
+	}
+
+	/**
+	 * Reads the response to a "put" command returning the job id or false
+	 */
+	protected function _readPutStatus() -> string|boolean
+	{
+		var response, status;
+
 		let response = this->readStatus();
-		if response[0] == "FOUND" {
-			return new Job(this, response[1], unserialize(this->read(response[2])));
+		let status = response[0];
+
+		if status == "INSERTED" || status == "BURIED" {
+			return response[1];
 		}
 
 		return false;
 	}
 
 	/**
-	 * Return the next job in the list of buried jobs
+	 * Reads a job from the server if the response status is the expected one
 	 */
-	public function peekBuried() -> boolean|<Job>
+	protected function _readJob(string! expected) -> boolean|<Job>
 	{
- 		var response;
-
-		this->write("peek-buried");
+		var response, body;
 
 		let response = this->readStatus();
-		if response[0] == "FOUND" {
-			return new Job(this, response[1], unserialize(this->read(response[2])));
+		if response[0] == expected {
+
+			/**
+			 * The job is in the first position
+			 * Next is the job length
+			 */
+			let body = this->read(response[2]);
+			if typeof body != "string" {
+				return false;
+			}
+
+			/**
+			 * The body is decoded by the job only when it's requested
+			 * Create a beanstalk job abstraction
+			 */
+			return new Job(this, response[1], null, body);
 		}
 
 		return false;
@@ -285,7 +599,8 @@ class Beanstalk
 	 */
 	protected function write(string data) -> boolean|int
 	{
- 		var connection, packet;
+ 		var connection, packet, written;
+		int length, offset;
 
 		let connection = this->_connection;
 		if typeof connection != "resource" {
@@ -295,8 +610,26 @@ class Beanstalk
 			}
 		}
 
-		let packet = data . "\r\n";
-		return fwrite(connection, packet, strlen(packet));
+		let packet = data . "\r\n",
+			length = strlen(packet),
+			offset = 0;
+
+		/**
+		 * fwrite() can write less than requested on sockets, the rest is written again
+		 */
+		while offset < length {
+			if offset {
+				let written = fwrite(connection, substr(packet, offset));
+			} else {
+				let written = fwrite(connection, packet);
+			}
+			if !written {
+				return false;
+			}
+			let offset += written;
+		}
+
+		return length;
 	}
 
 	/**
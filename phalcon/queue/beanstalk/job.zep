@@ -28,22 +28,62 @@ class Job
 {
 	protected _id { get };
 
-	protected _body { get };
+	protected _body;
+
+	protected _rawBody;
+
+	protected _decoded = false;
 
 	protected _queue;
 
 	/**
 	 * Phalcon\Queue\Beanstalk\Job
 	 *
+	 * The body is the decoded body of the job. When the raw body is passed instead the
+	 * job decodes it with the queue's serializer the first time getBody() is called
+	 *
 	 * @param Phalcon\Queue\Beanstalk queue
 	 * @param string id
-	 * @param string body
+	 * @param mixed body
+	 * @param string rawBody
 	 */
-	public function __construct(queue, id, body)
+	public function __construct(queue, id, body, rawBody = null)
 	{
 		let this->_queue = queue;
 		let this->_id = id;
-		let this->_body = body;
+
+		if typeof rawBody == "null" {
+			let this->_body = body,
+				this->_decoded = true;
+		} else {
+			let this->_rawBody = rawBody;
+		}
+	}
+
+	/**
+	 * Returns the body of the job. The body is decoded using the queue's serializer
+	 * the first time it's requested
+	 */
+	public function getBody()
+	{
+		if !this->_decoded {
+			let this->_body = this->_queue->decode(this->_rawBody);
+			let this->_decoded = true;
+		}
+
+		return this->_body;
+	}
+
+	/**
+	 * Returns the body of the job as it's stored in the server
+	 */
+	public function getRawBody() -> string
+	{
+		if typeof this->_rawBody == "null" {
+			let this->_rawBody = this->_queue->encode(this->_body);
+		}
+
+		return this->_rawBody;
 	}
 
 	/**
@@ -168,6 +168,92 @@ class Security implements InjectionAwareInterface
 		return starts_with(passwordHash, "$2a$");
 	}
 
+	/**
+	 * Checks if a password hash must be generated again because it isn't a bcrypt hash
+	 * or it was generated with a work factor different than the current one
+	 *
+	 *<code>
+	 *	if ($this->security->checkHash($password, $user->password)) {
+	 *		if ($this->security->needsRehash($user->password)) {
+	 *			$user->password = $this->security->hash($password);
+	 *			$user->save();
+	 *		}
+	 *	}
+	 *</code>
+	 */
+	public function needsRehash(string passwordHash, int workFactor = 0) -> boolean
+	{
+		var matches;
+
+		if !workFactor {
+			let workFactor = (int) this->_workFactor;
+		}
+
+		let matches = null;
+		if !preg_match("/^\\$2[axy]\\$([0-9]{2})\\$/", passwordHash, matches) {
+			return true;
+		}
+
+		return (int) matches[1] != workFactor;
+	}
+
+	/**
+	 * Measures the cost of hashing a password in the current machine and sets the highest
+	 * work factor whose hashes take less than the given milliseconds. Each increment of the
+	 * work factor doubles the cost, it's measured while it's cheap and extrapolated then,
+	 * so the calibration takes about the time of two hashes with the chosen work factor
+	 *
+	 *<code>
+	 *	$workFactor = $security->calibrateWorkFactor(250);
+	 *</code>
+	 */
+	public function calibrateWorkFactor(int targetMillis) -> int
+	{
+		int workFactor;
+		double elapsed;
+
+		if targetMillis <= 0 {
+			throw new Exception("The target time must be greater than zero");
+		}
+
+		let workFactor = 4,
+			elapsed = this->_measureHash(workFactor);
+
+		while workFactor < 31 && elapsed * 2 <= targetMillis {
+			let workFactor++;
+			if elapsed * 8 <= targetMillis {
+				let elapsed = this->_measureHash(workFactor);
+			} else {
+				let elapsed = elapsed * 2;
+			}
+		}
+
+		/**
+		 * The extrapolated work factor is measured and lowered until it fits the budget
+		 */
+		while workFactor > 4 && this->_measureHash(workFactor) > targetMillis {
+			let workFactor--;
+		}
+
+		let this->_workFactor = workFactor;
+		return workFactor;
+	}
+
+	/**
+	 * Returns the milliseconds spent hashing a password with a work factor
+	 */
+	protected function _measureHash(int workFactor) -> double
+	{
+		var salt, start;
+
+		let salt = "$2a$" . sprintf("%02s", workFactor) . "$" . this->getSaltBytes();
+
+		let start = microtime(true);
+		crypt("calibration", salt);
+
+		return (microtime(true) - start) * 1000;
+	}
+
 	/**
 	 * Generates a pseudo random token key to be used as input's name in a CSRF check
 	 */
@@ -23,6 +23,17 @@ namespace Phalcon\Session;
  * Phalcon\Session\Adapter
  *
  * Base class for Phalcon\Session adapters
+ *
+ * With the option 'lazy' the session is only started when it's accessed for the first time,
+ * with 'readOnly' the session is closed as soon as it's read, so the save handler is never
+ * locked or written in the request
+ *
+ *<code>
+ * $session = new \Phalcon\Session\Adapter\Files(array(
+ *    'lazy' => true,
+ *    'readOnly' => true
+ * ));
+ *</code>
  */
 abstract class Adapter
 {
@@ -33,6 +44,12 @@ abstract class Adapter
 
 	protected _options;
 
+	protected _lazy = false;
+
+	protected _readOnly = false;
+
+	protected _startPending = false;
+
 	/**
 	 * Phalcon\Session\Adapter constructor
 	 *
@@ -52,9 +69,41 @@ abstract class Adapter
 	 */
 	public function start() -> boolean
 	{
+		if !headers_sent() {
+
+			/**
+			 * Lazy sessions are started on the first access
+			 */
+			if this->_lazy {
+				let this->_startPending = true;
+				return true;
+			}
+
+			return this->_start();
+		}
+		return false;
+	}
+
+	/**
+	 * Starts the native session, read-only sessions are closed without writing them
+	 *
+	 * @return boolean
+	 */
+	protected function _start() -> boolean
+	{
+		let this->_startPending = false;
+
 		if !headers_sent() {
 			session_start();
 			let this->_started = true;
+
+			if this->_readOnly {
+				if function_exists("session_abort") {
+					session_abort();
+				} else {
+					session_write_close();
+				}
+			}
 			return true;
 		}
 		return false;
@@ -73,12 +122,20 @@ abstract class Adapter
 	 */
 	public function setOptions(array! options)
 	{
-		var uniqueId;
+		var uniqueId, lazy, readOnly;
 
 		if fetch uniqueId, options["uniqueId"] {
 			let this->_uniqueId = uniqueId;
 		}
 
+		if fetch lazy, options["lazy"] {
+			let this->_lazy = (bool) lazy;
+		}
+
+		if fetch readOnly, options["readOnly"] {
+			let this->_readOnly = (bool) readOnly;
+		}
+
 		let this->_options = options;
 	}
 
@@ -104,6 +161,10 @@ abstract class Adapter
 	{
 		var value, key;
 
+		if this->_startPending {
+			this->_start();
+		}
+
 		let key = this->_uniqueId . index;
 		if fetch value, _SESSION[key] {
 			if !empty value {
@@ -128,6 +189,10 @@ abstract class Adapter
 	 */
 	public function set(string index, value)
 	{
+		if this->_startPending {
+			this->_start();
+		}
+
 		let _SESSION[this->_uniqueId . index] = value;
 	}
 
@@ -142,6 +207,10 @@ abstract class Adapter
 	 */
 	public function has(string index) -> boolean
 	{
+		if this->_startPending {
+			this->_start();
+		}
+
 		return isset _SESSION[this->_uniqueId . index];
 	}
 
@@ -154,6 +223,10 @@ abstract class Adapter
 	 */
 	public function remove(string index)
 	{
+		if this->_startPending {
+			this->_start();
+		}
+
 		unset _SESSION[this->_uniqueId . index];
 	}
 
@@ -166,6 +239,10 @@ abstract class Adapter
 	 */
 	public function getId() -> string
 	{
+		if this->_startPending {
+			this->_start();
+		}
+
 		return session_id();
 	}
 	
@@ -184,7 +261,7 @@ abstract class Adapter
 	}
 
 	/**
-	 * Check whether the session has been started
+	 * Check whether the session has been started, a lazy session is considered started
 	 *
 	 *<code>
 	 *	var_dump($session->isStarted());
@@ -192,7 +269,19 @@ abstract class Adapter
 	 */
 	public function isStarted() -> boolean
 	{
-		return this->_started;
+		return this->_started || this->_startPending;
+	}
+
+	/**
+	 * Check whether the session is closed as soon as it's read
+	 *
+	 *<code>
+	 *	var_dump($session->isReadOnly());
+	 *</code>
+	 */
+	public function isReadOnly() -> boolean
+	{
+		return this->_readOnly;
 	}
 
 	/**
@@ -204,6 +293,10 @@ abstract class Adapter
 	 */
 	public function destroy() -> boolean
 	{
+		if this->_startPending {
+			this->_start();
+		}
+
 		let this->_started = false;
 		return session_destroy();
 	}
@@ -49,6 +49,10 @@ use Phalcon\Cache\Frontend\Data as FrontendData;
  *
  * echo $session->get('var');
  *</code>
+ *
+ * Unchanged sessions are not written again, only their lifetime is refreshed. With the
+ * option 'cas' the session is written with an optimistic check instead of overwriting it,
+ * if another request changed the session after it was read the write is rejected
  */
 class Libmemcached extends Adapter implements AdapterInterface
 {
@@ -57,6 +61,14 @@ class Libmemcached extends Adapter implements AdapterInterface
 
 	protected _lifetime = 8600 { get };
 
+	protected _cas = false;
+
+	protected _sessionId;
+
+	protected _data;
+
+	protected _casToken;
+
 	/**
 	 * Phalcon\Session\Adapter\Libmemcached constructor
 	 *
@@ -64,7 +76,7 @@ class Libmemcached extends Adapter implements AdapterInterface
 	 */
 	public function __construct(options = null)
 	{
-		var servers, client, lifetime, prefix, statsKey;
+		var servers, client, lifetime, prefix, statsKey, cas;
 
 		if typeof options != "array" {
 			throw new Exception("The options must be an array");
@@ -94,10 +106,16 @@ class Libmemcached extends Adapter implements AdapterInterface
 			let prefix = options["prefix"];
 		}
 
+		/**
+		 * Session keys aren't tracked in the stats key unless it's explicitly requested,
+		 * tracking them costs a read and a write of the whole keys list on every save
+		 */
 		if !fetch statsKey, options["statsKey"] {
-			let statsKey = NULL;
-		} else {
-			let statsKey = options["statsKey"];
+			let statsKey = "";
+		}
+
+		if fetch cas, options["cas"] {
+			let this->_cas = (bool) cas;
 		}
 
 		let this->_libmemcached = new Libmemcached(
@@ -135,7 +153,25 @@ class Libmemcached extends Adapter implements AdapterInterface
 	 */
     public function read(sessionId)
     {
-        return this->_libmemcached->get(sessionId, this->_lifetime);
+        var item, data;
+
+        if this->_cas {
+            let item = this->_libmemcached->getWithCas(sessionId);
+            if typeof item == "array" {
+                let data = item["content"],
+                    this->_casToken = item["cas"];
+            } else {
+                let data = null,
+                    this->_casToken = null;
+            }
+        } else {
+            let data = this->_libmemcached->get(sessionId, this->_lifetime);
+        }
+
+        let this->_sessionId = sessionId,
+            this->_data = data;
+
+        return data;
     }
 
     /**
@@ -146,7 +182,30 @@ class Libmemcached extends Adapter implements AdapterInterface
      */
     public function write(sessionId, data)
     {
+        /**
+         * The session didn't change since it was read, only its lifetime is refreshed
+         */
+        if sessionId === this->_sessionId {
+            if data === this->_data {
+                if this->_libmemcached->touch(sessionId, this->_lifetime) {
+                    return true;
+                }
+            } else {
+                if empty data && empty this->_data {
+                    return true;
+                }
+            }
+        }
+
+        if this->_cas {
+            if sessionId !== this->_sessionId {
+                let this->_casToken = null;
+            }
+            return this->_libmemcached->saveWithCas(sessionId, data, this->_casToken, this->_lifetime);
+        }
+
         this->_libmemcached->save(sessionId, data, this->_lifetime);
+        return true;
     }
 
     /**
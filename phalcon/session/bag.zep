@@ -22,6 +22,7 @@ namespace Phalcon\Session;
 use Phalcon\Di;
 use Phalcon\DiInterface;
 use Phalcon\Di\InjectionAwareInterface;
+use Phalcon\Cache\BackendInterface;
 
 /**
  * Phalcon\Session\Bag
@@ -34,6 +35,27 @@ use Phalcon\Di\InjectionAwareInterface;
  *	$user->name = "Kimbra Johnson";
  *	$user->age = 22;
  *</code>
+ *
+ * A bag created with the option 'deferred' keeps its changes in memory and writes them back
+ * to the session once, at the end of the request. With the option 'storage' the bag is kept
+ * under its own key in a cache backend instead of the session, so it's only read by the
+ * requests that access it. The key of the bag in the backend is built from a token stored
+ * in the session the first time a bag uses it, so the bag survives session_regenerate_id().
+ * Backends able to touch() their keys (Libmemcached) get the lifetime of the bag refreshed
+ * every time it's read, with others the bag expires after the lifetime of the backend
+ * unless it's changed
+ *
+ * Deferred bags are written by Phalcon\Session\Bag::writePending(), which runs at the end of
+ * the request and is called by Phalcon\Mvc\Application::reset() and Phalcon\Mvc\Micro::reset()
+ * in long running processes
+ *
+ *<code>
+ *	$cart = new \Phalcon\Session\Bag('cart', array(
+ *		'storage' => new \Phalcon\Cache\Backend\Libmemcached(
+ *			new \Phalcon\Cache\Frontend\Data(array('lifetime' => 3600))
+ *		)
+ *	));
+ *</code>
  */
 class Bag implements InjectionAwareInterface, BagInterface
 {
@@ -48,14 +70,48 @@ class Bag implements InjectionAwareInterface, BagInterface
 
 	protected _session;
 
+	protected _deferred = false;
+
+	protected _storage;
+
+	protected _storageKey;
+
+	protected _dirty = false;
+
+	protected static _pending;
+
+	protected static _shutdownRegistered = false;
+
 	/**
 	 * Phalcon\Session\Bag constructor
 	 *
 	 * @param string name
+	 * @param array options
 	 */
-	public function __construct(string! name)
+	public function __construct(string! name, var options = null)
 	{
+		var deferred, storage;
+
 		let this->_name = name;
+
+		if typeof options == "array" {
+
+			if fetch deferred, options["deferred"] {
+				let this->_deferred = (bool) deferred;
+			}
+
+			if fetch storage, options["storage"] {
+				if typeof storage != "object" || !(storage instanceof BackendInterface) {
+					throw new Exception("The bag storage must be an object compatible with Phalcon\\Cache\\BackendInterface");
+				}
+
+				/**
+				 * Bags in a cache backend are always written at the end of the request
+				 */
+				let this->_storage = storage,
+					this->_deferred = true;
+			}
+		}
 	}
 
 	/**
@@ -83,7 +139,7 @@ class Bag implements InjectionAwareInterface, BagInterface
 	 */
 	public function initialize()
 	{
-		var session, dependencyInjector, data;
+		var session, dependencyInjector, data, storage, token;
 
 		let session = this->_session;
 		if typeof session != "object" {
@@ -100,7 +156,33 @@ class Bag implements InjectionAwareInterface, BagInterface
 				this->_session = session;
 		}
 
-		let data = session->get(this->_name);
+		let storage = this->_storage;
+		if typeof storage == "object" {
+
+			/**
+			 * The session id changes when it's regenerated, the token is kept with the session data
+			 */
+			let token = session->get("$PHALCON/BAG$");
+			if !token {
+				let token = md5(uniqid(mt_rand(), true));
+				session->set("$PHALCON/BAG$", token);
+			}
+
+			let this->_storageKey = token . "_" . this->_name,
+				data = storage->get(this->_storageKey);
+
+			/**
+			 * Bags that are only read keep living as long as they're used
+			 */
+			if typeof data == "array" {
+				if method_exists(storage, "touch") {
+					storage->touch(this->_storageKey);
+				}
+			}
+		} else {
+			let data = session->get(this->_name);
+		}
+
 		if typeof data != "array" {
 			let data = [];
 		}
@@ -120,7 +202,15 @@ class Bag implements InjectionAwareInterface, BagInterface
 		if this->_initalized === false {
 			this->initialize();
 		}
-		this->_session->remove(this->_name);
+
+		let this->_data = [],
+			this->_dirty = false;
+
+		if typeof this->_storage == "object" {
+			this->_storage->delete(this->_storageKey);
+		} else {
+			this->_session->remove(this->_name);
+		}
 	}
 
 	/**
@@ -139,7 +229,12 @@ class Bag implements InjectionAwareInterface, BagInterface
 			this->initialize();
 		}
 		let this->_data[property] = value;
-		this->_session->set(this->_name, this->_data);
+
+		if this->_deferred {
+			this->_markDirty();
+		} else {
+			this->_session->set(this->_name, this->_data);
+		}
 	}
 
 	/**
@@ -250,9 +345,18 @@ class Bag implements InjectionAwareInterface, BagInterface
 	 */
 	public function remove(string! property) -> boolean
 	{
+		if this->_initalized === false {
+			this->initialize();
+		}
+
 		if isset this->_data[property] {
 			unset this->_data[property];
-			this->_session->set(this->_name, this->_data);
+
+			if this->_deferred {
+				this->_markDirty();
+			} else {
+				this->_session->set(this->_name, this->_data);
+			}
 			return true;
 		}
 		return false;
@@ -272,4 +376,84 @@ class Bag implements InjectionAwareInterface, BagInterface
 	{
 		return this->remove(property);
 	}
+
+	/**
+	 * Writes the changes of a deferred bag back to the session or its storage. It's called
+	 * by writePending(), it must be called manually if the session is closed before
+	 *
+	 *<code>
+	 * $cart->write();
+	 * session_write_close();
+	 *</code>
+	 *
+	 * @return boolean
+	 */
+	public function write() -> boolean
+	{
+		var storage;
+
+		if !this->_dirty {
+			return false;
+		}
+
+		let this->_dirty = false;
+
+		let storage = this->_storage;
+		if typeof storage == "object" {
+			if count(this->_data) {
+				storage->save(this->_storageKey, this->_data);
+			} else {
+				storage->delete(this->_storageKey);
+			}
+		} else {
+			this->_session->set(this->_name, this->_data);
+		}
+
+		return true;
+	}
+
+	/**
+	 * Writes every deferred bag changed since the last call, returns the number of bags written
+	 *
+	 *<code>
+	 * \Phalcon\Session\Bag::writePending();
+	 *</code>
+	 */
+	public static function writePending() -> int
+	{
+		var pending, bag;
+		int number = 0;
+
+		let pending = self::_pending,
+			self::_pending = [];
+
+		if typeof pending == "array" {
+			for bag in pending {
+				if bag->write() {
+					let number++;
+				}
+			}
+		}
+
+		return number;
+	}
+
+	/**
+	 * Marks the bag as changed, the first time the bag is queued to be written by writePending()
+	 */
+	protected function _markDirty() -> void
+	{
+		if !this->_dirty {
+			if this->_initalized === false {
+				this->initialize();
+			}
+			let this->_dirty = true,
+				self::_pending[spl_object_hash(this)] = this;
+
+			if !self::_shutdownRegistered {
+				let self::_shutdownRegistered = true;
+				register_shutdown_function(["Phalcon\\Session\\Bag", "writePending"]);
+			}
+		}
+	}
 }
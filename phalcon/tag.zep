@@ -23,6 +23,7 @@ namespace Phalcon;
 use Phalcon\DiInterface;
 use Phalcon\Tag\Select;
 use Phalcon\Tag\Exception;
+use Phalcon\Tag\Template;
 use Phalcon\Mvc\UrlInterface;
 use Phalcon\EscaperInterface;
 
@@ -62,6 +63,11 @@ class Tag
 
 	protected static _autoEscape = true;
 
+	/**
+	 * Helper calls compiled by Phalcon\Tag::compile
+	 */
+	protected static _templates;
+
 	const HTML32 = 1;
 
 	const HTML401_STRICT = 2;
@@ -167,7 +173,10 @@ class Tag
 	 */
 	public static function setDI(<DiInterface> dependencyInjector)
 	{
-		let self::_dependencyInjector = dependencyInjector;
+		let self::_dependencyInjector = dependencyInjector,
+			self::_urlService = null,
+			self::_escaperService = null,
+			self::_templates = null;
 	}
 
 	/**
@@ -361,6 +370,40 @@ class Tag
 		let self::_displayValues = [], {"_POST"} = [];
 	}
 
+	/**
+	 * Compiles a helper call with constant parameters into a template, the attributes
+	 * in 'dynamic' are escaped and spliced in every time the template is rendered.
+	 * Templates are kept for the process so compiling the same call again is cheap
+	 *
+	 *<code>
+	 *	$template = Phalcon\Tag::compile("textField", array("email", "class" => "input"), array("value"));
+	 *	echo $template->render(array("value" => "john@example.com"));
+	 *</code>
+	 *
+	 * @param string helper
+	 * @param array|string parameters
+	 * @param array dynamic
+	 * @return Phalcon\Tag\Template
+	 */
+	public static function compile(string! helper, parameters, array! dynamic) -> <Template>
+	{
+		var key, templates, template;
+
+		let key = md5(serialize([helper, parameters, dynamic, self::_documentType, self::_autoEscape])),
+			templates = self::_templates;
+
+		if typeof templates == "array" {
+			if fetch template, templates[key] {
+				return template;
+			}
+		}
+
+		let template = new Template(helper, parameters, dynamic),
+			self::_templates[key] = template;
+
+		return template;
+	}
+
 	/**
 	 * Builds a HTML A tag using framework conventions
 	 *
@@ -0,0 +1,197 @@
+
+/*
+ +------------------------------------------------------------------------+
+ | Phalcon Framework                                                      |
+ +------------------------------------------------------------------------+
+ | Copyright (c) 2011-2015 Phalcon Team (http://www.phalconphp.com)       |
+ +------------------------------------------------------------------------+
+ | This source file is subject to the New BSD License that is bundled     |
+ | with this package in the file docs/LICENSE.txt.                        |
+ |                                                                        |
+ | If you did not receive a copy of the license and are unable to         |
+ | obtain it through the world-wide-web, please send an email             |
+ | to license@phalconphp.com so we can send you a copy immediately.       |
+ +------------------------------------------------------------------------+
+ | Authors: Andres Gutierrez <andres@phalconphp.com>                      |
+ |          Eduar Carvajal <eduar@phalconphp.com>                         |
+ +------------------------------------------------------------------------+
+ */
+
+namespace Phalcon\Tag;
+
+use Phalcon\Tag;
+use Phalcon\Tag\Exception;
+
+/**
+ * Phalcon\Tag\Template
+ *
+ * A helper call compiled once into the HTML it produces, only the dynamic attributes
+ * are escaped and spliced in every time it's rendered
+ *
+ * Fields without a constant value read it through Phalcon\Tag::getValue() when they're
+ * rendered, as the helpers do, so defaults and submitted values are never compiled in.
+ * Check boxes, radios and selects without a constant value can't be compiled
+ *
+ *<code>
+ * $template = Phalcon\Tag::compile("textField", array("email", "class" => "input"), array("value"));
+ *
+ * foreach ($users as $user) {
+ *     echo $template->render(array("value" => $user->email));
+ * }
+ *</code>
+ */
+class Template
+{
+
+	protected _parts;
+
+	protected _slots;
+
+	protected _escape;
+
+	protected _valueId;
+
+	/**
+	 * Phalcon\Tag\Template constructor
+	 *
+	 * @param string helper
+	 * @param array|string parameters
+	 * @param array dynamic
+	 */
+	public function __construct(string! helper, parameters, array! dynamic)
+	{
+		var params, position, name, html, pieces, piece, parts, slots, found, lowerHelper, id;
+		int index;
+
+		if typeof parameters != "array" {
+			let params = [parameters];
+		} else {
+			let params = parameters;
+		}
+
+		/**
+		 * Helpers whose output depends on the default or submitted value of the field
+		 */
+		let lowerHelper = strtolower(helper);
+		if !isset params["value"] {
+
+			if in_array(lowerHelper, ["checkfield", "radiofield", "select", "selectstatic"], true) {
+				throw new Exception("The helper '" . helper . "' cannot be compiled without a constant value");
+			}
+
+			if in_array(lowerHelper, [
+				"colorfield", "textfield", "numericfield", "rangefield", "emailfield", "datefield",
+				"datetimefield", "datetimelocalfield", "monthfield", "timefield", "weekfield",
+				"passwordfield", "hiddenfield", "filefield", "searchfield", "telfield", "urlfield",
+				"textarea"
+			], true) {
+
+				if !fetch id, params[0] {
+					if !fetch id, params["id"] {
+						let id = null;
+					}
+				}
+
+				let this->_valueId = id;
+				if !in_array("value", dynamic, true) {
+					let dynamic[] = "value";
+				}
+			}
+
+		} else {
+
+			/**
+			 * The checked state is always computed from the submitted value
+			 */
+			if in_array(lowerHelper, ["checkfield", "radiofield"], true) {
+				throw new Exception("The helper '" . helper . "' cannot be compiled");
+			}
+		}
+
+		/**
+		 * Dynamic attributes are replaced by markers found later in the generated HTML
+		 */
+		for position, name in dynamic {
+			let params[name] = chr(1) . position . chr(1);
+		}
+
+		let this->_escape = typeof Tag::getEscaper(params) == "object";
+
+		let html = call_user_func(["Phalcon\\Tag", helper], params);
+
+		let parts = [],
+			slots = [],
+			found = [],
+			pieces = explode(chr(1), html);
+
+		for position, piece in pieces {
+
+			if position % 2 == 0 {
+				let parts[] = piece;
+				continue;
+			}
+
+			let index = (int) piece;
+			if !fetch name, dynamic[index] {
+				throw new Exception("The helper '" . helper . "' cannot be compiled");
+			}
+
+			if isset found[index] {
+				throw new Exception("Attribute '" . name . "' cannot be dynamic in the helper '" . helper . "'");
+			}
+
+			let found[index] = true,
+				slots[] = name;
+		}
+
+		for name in dynamic {
+			if !in_array(name, slots, true) {
+				throw new Exception("Attribute '" . name . "' cannot be dynamic in the helper '" . helper . "'");
+			}
+		}
+
+		let this->_parts = parts,
+			this->_slots = slots;
+	}
+
+	/**
+	 * Generates the HTML with the passed values for the dynamic attributes
+	 */
+	public function render(array values = []) -> string
+	{
+		var parts, escaper, code, position, name, value, valueId;
+		int index;
+
+		let parts = this->_parts,
+			valueId = this->_valueId;
+
+		if this->_escape {
+			let escaper = Tag::getEscaperService();
+		} else {
+			let escaper = null;
+		}
+
+		let code = parts[0];
+		for position, name in this->_slots {
+
+			if !fetch value, values[name] {
+				let value = null;
+				if name == "value" && valueId !== null {
+					let value = Tag::getValue(valueId);
+				}
+				if value === null {
+					let value = "";
+				}
+			}
+
+			if escaper {
+				let value = escaper->escapeHtmlAttr(value);
+			}
+
+			let index = position + 1,
+				code .= value . parts[index];
+		}
+
+		return code;
+	}
+}
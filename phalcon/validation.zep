@@ -20,6 +20,8 @@
 namespace Phalcon;
 
 use Phalcon\Di\Injectable;
+use Phalcon\Validation\Batch;
+use Phalcon\Validation\ColumnValidatorInterface;
 use Phalcon\Validation\Exception;
 use Phalcon\Validation\MessageInterface;
 use Phalcon\Validation\Message\Group;
@@ -82,7 +84,7 @@ class Validation extends Injectable
 	 */
 	public function validate(var data = null, var entity = null) -> <Group>
 	{
-		var validators, messages, scope, field, validator, status;
+		var validators, messages, scope, field, validator, status, fieldScoped, cancelled;
 
 		let validators = this->_validators;
 		if typeof validators != "array" {
@@ -119,6 +121,8 @@ class Validation extends Injectable
 			}
 		}
 
+		let cancelled = [];
+
 		for scope in validators {
 
 			if typeof scope != "array" {
@@ -133,10 +137,24 @@ class Validation extends Injectable
 			}
 
 			/**
-			 * Check if the validation must be canceled if this validator fails
+			 * Skip the field if a validator canceled the rest of its validators
+			 */
+			if isset cancelled[field] {
+				continue;
+			}
+
+			/**
+			 * Check if the validation must be canceled if this validator fails, scopes
+			 * marked as field scoped only cancel the remaining validators of the field
 			 */
 			if validator->validate(this, field) === false {
 				if validator->getOption("cancelOnFail") {
+					if fetch fieldScoped, scope[2] {
+						if fieldScoped {
+							let cancelled[field] = true;
+							continue;
+						}
+					}
 					break;
 				}
 			}
@@ -153,6 +171,219 @@ class Validation extends Injectable
 		return messages;
 	}
 
+	/**
+	 * Validates a set of rows with the same validators. Validators implementing
+	 * Phalcon\Validation\ColumnValidatorInterface check the values of all the rows at once,
+	 * instead of messages a bitmap of the failed validators is kept for every row that failed.
+	 * The bound entity and the 'beforeValidation'/'afterValidation' callbacks are not used
+	 *
+	 *<code>
+	 *$batch = $validation->validateBatch($rows);
+	 *foreach ($batch->getFailedRows() as $row) {
+	 *	$messages = $batch->getMessages($row);
+	 *}
+	 *</code>
+	 *
+	 * @param array rows
+	 * @return Phalcon\Validation\Batch
+	 */
+	public function validateBatch(array! rows) -> <Batch>
+	{
+		var validators, filters, filterService, dependencyInjector, columns, column,
+			bitmaps, bitmap, cancelled, cancelledRows, fieldCancelled, fieldScoped,
+			scope, field, validator, fieldFilters, key, row, value, values, failed;
+		int bit;
+
+		let validators = this->_validators;
+		if typeof validators != "array" {
+			throw new Exception("There are no validators to validate");
+		}
+
+		if count(validators) > PHP_INT_SIZE * 8 {
+			throw new Exception("A batch validation supports up to " . (PHP_INT_SIZE * 8) . " validators");
+		}
+
+		let filters = this->_filters,
+			filterService = null,
+			columns = [],
+			bitmaps = [],
+			cancelled = [],
+			cancelledRows = [],
+			bit = 1;
+
+		let this->_entity = null;
+
+		for scope in validators {
+
+			if typeof scope != "array" {
+				throw new Exception("The validator scope is not valid");
+			}
+
+			let field = scope[0],
+				validator = scope[1];
+
+			if typeof validator != "object" {
+				throw new Exception("One of the validators is not valid");
+			}
+
+			/**
+			 * The values of a field are read and filtered once for all its validators
+			 */
+			if !fetch column, columns[field] {
+
+				let fieldFilters = null;
+				if typeof filters == "array" {
+					fetch fieldFilters, filters[field];
+				}
+
+				if fieldFilters && typeof filterService != "object" {
+
+					let dependencyInjector = this->getDI();
+					if typeof dependencyInjector != "object" {
+						let dependencyInjector = \Phalcon\Di::getDefault();
+						if typeof dependencyInjector != "object" {
+							throw new Exception("A dependency injector is required to obtain the 'filter' service");
+						}
+					}
+
+					let filterService = dependencyInjector->getShared("filter");
+					if typeof filterService != "object" {
+						throw new Exception("Returned 'filter' service is invalid");
+					}
+				}
+
+				let column = [];
+				for key, row in rows {
+
+					let value = null;
+					if typeof row == "array" {
+						if isset row[field] {
+							let value = row[field];
+						}
+					} else {
+						if typeof row == "object" {
+							if isset row->{field} {
+								let value = row->{field};
+							}
+						}
+					}
+
+					if fieldFilters && typeof value != "null" {
+						let value = filterService->sanitize(value, fieldFilters);
+					}
+
+					let column[key] = value;
+				}
+
+				let columns[field] = column;
+			}
+
+			/**
+			 * Skip the rows where a validator with 'cancelOnFail' already failed
+			 */
+			let values = column;
+			if count(cancelledRows) {
+				let values = array_diff_key(values, cancelledRows);
+			}
+			if fetch fieldCancelled, cancelled[field] {
+				let values = array_diff_key(values, fieldCancelled);
+			}
+
+			if validator instanceof ColumnValidatorInterface {
+				let failed = validator->validateColumn(values);
+			} else {
+
+				/**
+				 * Other validators check the rows one by one, their messages are discarded
+				 */
+				let failed = [],
+					this->_messages = new Group();
+
+				for key, value in values {
+					fetch row, rows[key];
+					let this->_data = row,
+						this->_values = [];
+					let this->_values[field] = value;
+					if validator->validate(this, field) === false {
+						let failed[key] = value;
+					}
+				}
+			}
+
+			for key, value in failed {
+				if fetch bitmap, bitmaps[key] {
+					let bitmaps[key] = bitmap | bit;
+				} else {
+					let bitmaps[key] = bit;
+				}
+			}
+
+			if count(failed) && validator->getOption("cancelOnFail") {
+				let fieldScoped = false;
+				fetch fieldScoped, scope[2];
+				if fieldScoped {
+					if fetch fieldCancelled, cancelled[field] {
+						let cancelled[field] = failed + fieldCancelled;
+					} else {
+						let cancelled[field] = failed;
+					}
+				} else {
+					let cancelledRows = failed + cancelledRows;
+				}
+			}
+
+			let bit = bit << 1;
+		}
+
+		let this->_data = null,
+			this->_values = null,
+			this->_messages = new Group();
+
+		return new Batch(this, rows, bitmaps);
+	}
+
+	/**
+	 * Generates the messages of a row validated with validateBatch(), only the validators
+	 * marked in the bitmap are executed
+	 *
+	 * @param array|object data
+	 * @param int bitmap
+	 * @return Phalcon\Validation\Message\Group
+	 */
+	public function getBatchMessages(var data, int bitmap) -> <Group>
+	{
+		var validators, messages, scope, field, validator;
+		int bit;
+
+		if typeof data != "array" && typeof data != "object" {
+			throw new Exception("Data to validate must be an array or object");
+		}
+
+		let validators = this->_validators;
+		if typeof validators != "array" {
+			throw new Exception("There are no validators to validate");
+		}
+
+		let messages = new Group(),
+			bit = 1;
+
+		let this->_messages = messages,
+			this->_data = data,
+			this->_values = null,
+			this->_entity = null;
+
+		for scope in validators {
+			if bitmap & bit {
+				let field = scope[0],
+					validator = scope[1];
+				validator->validate(this, field);
+			}
+			let bit = bit << 1;
+		}
+
+		return messages;
+	}
+
 	/**
 	 * Adds a validator to a field
 	 *
@@ -466,7 +697,7 @@ class Validation extends Injectable
 							throw new Exception("Returned 'filter' service is invalid");
 						}
 
-						return filterService->sanitize(value, fieldFilters);
+						let value = filterService->sanitize(value, fieldFilters);
 					}
 				}
 			}
@@ -0,0 +1,125 @@
+
+/*
+ +------------------------------------------------------------------------+
+ | Phalcon Framework                                                      |
+ +------------------------------------------------------------------------+
+ | Copyright (c) 2011-2015 Phalcon Team (http://www.phalconphp.com)       |
+ +------------------------------------------------------------------------+
+ | This source file is subject to the New BSD License that is bundled     |
+ | with this package in the file docs/LICENSE.txt.                        |
+ |                                                                        |
+ | If you did not receive a copy of the license and are unable to         |
+ | obtain it through the world-wide-web, please send an email             |
+ | to license@phalconphp.com so we can send you a copy immediately.       |
+ +------------------------------------------------------------------------+
+ | Authors: Andres Gutierrez <andres@phalconphp.com>                      |
+ |          Eduar Carvajal <eduar@phalconphp.com>                         |
+ +------------------------------------------------------------------------+
+ */
+
+namespace Phalcon\Validation;
+
+use Phalcon\Validation;
+use Phalcon\Validation\Message\Group;
+
+/**
+ * Phalcon\Validation\Batch
+ *
+ * Result of validating a set of rows with Phalcon\Validation::validateBatch(). Only the
+ * rows that failed are kept together with a bitmap of the validators that failed on them,
+ * the bit n corresponds to the n-th validator added to the validation. The messages
+ * of a row are only generated when they're requested
+ *
+ *<code>
+ *$batch = $validation->validateBatch($rows);
+ *if (!$batch->isValid()) {
+ *	foreach ($batch->getFailedRows() as $row) {
+ *		foreach ($batch->getMessages($row) as $message) {
+ *			echo $row, ': ', $message, PHP_EOL;
+ *		}
+ *	}
+ *}
+ *</code>
+ */
+class Batch implements \Countable
+{
+
+	protected _validation;
+
+	protected _rows;
+
+	protected _bitmaps { get };
+
+	/**
+	 * Phalcon\Validation\Batch constructor
+	 *
+	 * @param Phalcon\Validation validation
+	 * @param array rows
+	 * @param array bitmaps
+	 */
+	public function __construct(<Validation> validation, array! rows, array! bitmaps)
+	{
+		let this->_validation = validation,
+			this->_rows = rows,
+			this->_bitmaps = bitmaps;
+	}
+
+	/**
+	 * Checks if all the rows passed the validation
+	 */
+	public function isValid() -> boolean
+	{
+		return count(this->_bitmaps) == 0;
+	}
+
+	/**
+	 * Returns the number of rows that failed
+	 */
+	public function count() -> int
+	{
+		return count(this->_bitmaps);
+	}
+
+	/**
+	 * Returns the keys of the rows that failed
+	 */
+	public function getFailedRows() -> array
+	{
+		return array_keys(this->_bitmaps);
+	}
+
+	/**
+	 * Returns the bitmap of the validators that failed on a row, 0 if the row is valid
+	 *
+	 * @param int|string row
+	 * @return int
+	 */
+	public function getBitmap(var row) -> int
+	{
+		var bitmap;
+
+		if fetch bitmap, this->_bitmaps[row] {
+			return bitmap;
+		}
+		return 0;
+	}
+
+	/**
+	 * Returns the messages of a row, they're generated running again only the validators
+	 * that failed on it
+	 *
+	 * @param int|string row
+	 * @return Phalcon\Validation\Message\Group
+	 */
+	public function getMessages(var row) -> <Group>
+	{
+		var bitmap, data;
+
+		if !fetch bitmap, this->_bitmaps[row] {
+			return new Group();
+		}
+
+		fetch data, this->_rows[row];
+		return this->_validation->getBatchMessages(data, bitmap);
+	}
+}
@@ -0,0 +1,40 @@
+
+/*
+ +------------------------------------------------------------------------+
+ | Phalcon Framework                                                      |
+ +------------------------------------------------------------------------+
+ | Copyright (c) 2011-2015 Phalcon Team (http://www.phalconphp.com)       |
+ +------------------------------------------------------------------------+
+ | This source file is subject to the New BSD License that is bundled     |
+ | with this package in the file docs/LICENSE.txt.                        |
+ |                                                                        |
+ | If you did not receive a copy of the license and are unable to         |
+ | obtain it through the world-wide-web, please send an email             |
+ | to license@phalconphp.com so we can send you a copy immediately.       |
+ +------------------------------------------------------------------------+
+ | Authors: Andres Gutierrez <andres@phalconphp.com>                      |
+ |          Eduar Carvajal <eduar@phalconphp.com>                         |
+ +------------------------------------------------------------------------+
+ */
+
+namespace Phalcon\Validation;
+
+/**
+ * Phalcon\Validation\ColumnValidatorInterface
+ *
+ * Validators implementing this interface are able to check a whole column of values
+ * at once when a set of rows is validated with Phalcon\Validation::validateBatch()
+ */
+interface ColumnValidatorInterface
+{
+
+	/**
+	 * Checks a column of values and returns the ones that don't pass the validation
+	 * preserving their keys
+	 *
+	 * @param array values
+	 * @return array
+	 */
+	public function validateColumn(array! values) -> array;
+
+}
@@ -20,6 +20,7 @@
 namespace Phalcon\Validation\Validator;
 
 use Phalcon\Validation\Validator;
+use Phalcon\Validation\ColumnValidatorInterface;
 use Phalcon\Validation\ValidatorInterface;
 use Phalcon\Validation\Exception;
 use Phalcon\Validation\Message;
@@ -38,7 +39,7 @@ use Phalcon\Validation\Message;
  *)));
  *</code>
  */
-class InclusionIn extends Validator implements ValidatorInterface
+class InclusionIn extends Validator implements ValidatorInterface, ColumnValidatorInterface
 {
 
 	/**
@@ -97,4 +98,62 @@ class InclusionIn extends Validator implements ValidatorInterface
 
 		return true;
 	}
+
+	/**
+	 * Returns the values of a column that aren't part of the domain. String values are
+	 * looked up in a hashed set of the domain when the result is the same as in_array()
+	 *
+	 * @param array values
+	 * @return array
+	 */
+	public function validateColumn(array! values) -> array
+	{
+		var domain, strict, allowEmpty, set, item, key, value, failed;
+
+		let domain = this->getOption("domain");
+		if typeof domain != "array" {
+			throw new Exception("Option 'domain' must be an array");
+		}
+
+		let strict = false;
+		if this->isSetOption("strict") {
+			let strict = this->getOption("strict");
+		}
+
+		/**
+		 * A loose comparison between numeric strings isn't a plain string comparison,
+		 * the set is only built if the domain can be compared by hashing
+		 */
+		let set = [];
+		for item in domain {
+			if typeof item != "string" || (!strict && is_numeric(item)) {
+				let set = null;
+				break;
+			}
+			let set[item] = true;
+		}
+
+		let allowEmpty = this->isSetOption("allowEmpty"),
+			failed = [];
+
+		for key, value in values {
+
+			if allowEmpty && empty value {
+				continue;
+			}
+
+			if typeof set == "array" && typeof value == "string" {
+				if !isset set[value] {
+					let failed[key] = value;
+				}
+				continue;
+			}
+
+			if !in_array(value, domain, strict) {
+				let failed[key] = value;
+			}
+		}
+
+		return failed;
+	}
 }
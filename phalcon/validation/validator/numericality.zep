@@ -22,6 +22,7 @@ namespace Phalcon\Validation\Validator;
 use Phalcon\Validation;
 use Phalcon\Validation\Message;
 use Phalcon\Validation\Validator;
+use Phalcon\Validation\ColumnValidatorInterface;
 use Phalcon\Validation\ValidatorInterface;
 
 /**
@@ -37,7 +38,7 @@ use Phalcon\Validation\ValidatorInterface;
  *)));
  *</code>
  */
-class Numericality extends Validator implements ValidatorInterface
+class Numericality extends Validator implements ValidatorInterface, ColumnValidatorInterface
 {
 
 	/**
@@ -76,4 +77,28 @@ class Numericality extends Validator implements ValidatorInterface
 
 		return true;
 	}
+
+	/**
+	 * Returns the values of a column that aren't numeric, the whole column is
+	 * matched at once
+	 *
+	 * @param array values
+	 * @return array
+	 */
+	public function validateColumn(array! values) -> array
+	{
+		var key, value, checked;
+
+		let checked = values;
+		if this->isSetOption("allowEmpty") {
+			let checked = [];
+			for key, value in values {
+				if !empty value {
+					let checked[key] = value;
+				}
+			}
+		}
+
+		return preg_grep("/^-?\d+\.?\d*$/", checked, PREG_GREP_INVERT);
+	}
 }
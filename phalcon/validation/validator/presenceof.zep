@@ -32,7 +32,7 @@ namespace Phalcon\Validation\Validator;
  *)));
  *</code>
  */
-class PresenceOf extends \Phalcon\Validation\Validator implements \Phalcon\Validation\ValidatorInterface
+class PresenceOf extends \Phalcon\Validation\Validator implements \Phalcon\Validation\ValidatorInterface, \Phalcon\Validation\ColumnValidatorInterface
 {
 
 	/**
@@ -67,4 +67,24 @@ class PresenceOf extends \Phalcon\Validation\Validator implements \Phalcon\Valid
 		return true;
 	}
 
+	/**
+	 * Returns the empty values of a column
+	 *
+	 * @param array values
+	 * @return array
+	 */
+	public function validateColumn(array! values) -> array
+	{
+		var key, value, failed;
+
+		let failed = [];
+		for key, value in values {
+			if empty value {
+				let failed[key] = value;
+			}
+		}
+
+		return failed;
+	}
+
 }
@@ -22,6 +22,7 @@ namespace Phalcon\Validation\Validator;
 use Phalcon\Validation;
 use Phalcon\Validation\Message;
 use Phalcon\Validation\Validator;
+use Phalcon\Validation\ColumnValidatorInterface;
 use Phalcon\Validation\ValidatorInterface;
 
 /**
@@ -38,7 +39,7 @@ use Phalcon\Validation\ValidatorInterface;
  *)));
  *</code>
  */
-class Regex extends Validator implements ValidatorInterface
+class Regex extends Validator implements ValidatorInterface, ColumnValidatorInterface
 {
 
 	/**
@@ -89,4 +90,37 @@ class Regex extends Validator implements ValidatorInterface
 		return true;
 	}
 
+	/**
+	 * Returns the values of a column that don't match the pattern
+	 *
+	 * @param array values
+	 * @return array
+	 */
+	public function validateColumn(array! values) -> array
+	{
+		var pattern, allowEmpty, key, value, matches, failed;
+
+		let pattern = this->getOption("pattern"),
+			allowEmpty = this->isSetOption("allowEmpty"),
+			failed = [];
+
+		for key, value in values {
+
+			if allowEmpty && empty value {
+				continue;
+			}
+
+			let matches = null;
+			if preg_match(pattern, value, matches) {
+				if matches[0] != value {
+					let failed[key] = value;
+				}
+			} else {
+				let failed[key] = value;
+			}
+		}
+
+		return failed;
+	}
+
 }
@@ -38,7 +38,7 @@ namespace Phalcon\Validation\Validator;
  *</code>
  *
  */
-class StringLength extends \Phalcon\Validation\Validator implements \Phalcon\Validation\ValidatorInterface
+class StringLength extends \Phalcon\Validation\Validator implements \Phalcon\Validation\ValidatorInterface, \Phalcon\Validation\ColumnValidatorInterface
 {
 
 	/**
@@ -129,4 +129,52 @@ class StringLength extends \Phalcon\Validation\Validator implements \Phalcon\Val
 		return true;
 	}
 
+	/**
+	 * Returns the values of a column that are too long or too short
+	 *
+	 * @param array values
+	 * @return array
+	 */
+	public function validateColumn(array! values) -> array
+	{
+		var isSetMin, isSetMax, minimum, maximum, allowEmpty, multiByte, key, value, length, failed;
+
+		let isSetMin = this->isSetOption("min"),
+			isSetMax = this->isSetOption("max");
+
+		if !isSetMin && !isSetMax {
+			throw new \Phalcon\Validation\Exception("A minimum or maximum must be set");
+		}
+
+		let minimum = this->getOption("min"),
+			maximum = this->getOption("max"),
+			allowEmpty = this->isSetOption("allowEmpty"),
+			multiByte = function_exists("mb_strlen"),
+			failed = [];
+
+		for key, value in values {
+
+			if allowEmpty && empty value {
+				continue;
+			}
+
+			if multiByte {
+				let length = mb_strlen(value);
+			} else {
+				let length = strlen(value);
+			}
+
+			if isSetMax && length > maximum {
+				let failed[key] = value;
+				continue;
+			}
+
+			if isSetMin && length < minimum {
+				let failed[key] = value;
+			}
+		}
+
+		return failed;
+	}
+
 }
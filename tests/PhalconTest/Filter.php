@@ -36,6 +36,16 @@ class Filter extends PhFilter
         return parent::sanitize($value, $filters, $noRecursive);
     }
 
+    public function sanitizeArray($data, $schema, $noRecursive = false)
+    {
+        return parent::sanitizeArray($data, $schema, $noRecursive);
+    }
+
+    public function compile($filters)
+    {
+        return parent::compile($filters);
+    }
+
     public function getFilters()
     {
         return parent::getFilters();
@@ -72,6 +72,11 @@ class Url extends PhUrl
         return parent::get($uri, $args, $local);
     }
 
+    public function getMany($routeName, array $parametersList, $local = true)
+    {
+        return parent::getMany($routeName, $parametersList, $local);
+    }
+
     public function getStatic($uri = null)
     {
         return parent::getStatic($uri);
@@ -67,6 +67,16 @@ class Security extends PhSecurity
         return parent::isLegacyHash($password, $passwordHash);
     }
 
+    public function needsRehash($passwordHash, $workFactor = 0)
+    {
+        return parent::needsRehash($passwordHash, $workFactor);
+    }
+
+    public function calibrateWorkFactor($targetMillis)
+    {
+        return parent::calibrateWorkFactor($targetMillis);
+    }
+
     public function getTokenKey($numberBytes = null)
     {
         return parent::getTokenKey($numberBytes);
@@ -92,6 +92,11 @@ class Tag extends PhTag
         return parent::resetInput();
     }
 
+    public static function compile($helper, $parameters, $dynamic)
+    {
+        return parent::compile($helper, $parameters, $dynamic);
+    }
+
     public static function linkTo($parameters, $text = null, $local = true)
     {
         return parent::linkTo($parameters, $text, $local);
@@ -284,6 +284,24 @@ class EscaperTest extends TBase
 
             }
         );
+
+        $this->specify(
+            'The escaper with escapeJs does not return the correct result for long alphanumeric runs',
+            function () {
+
+                $escaper = new PhTEscaper();
+
+                $run      = 'abcdefghijklmnopqrstuvwxyzABCDEFGHIJKLMNOPQRSTUVWXYZ0123456789';
+                $source   = $run . '=' . substr($run, 0, 7) . "'" . $run . $run
+                          . '<é>' . substr($run, 3, 5);
+                $expected = $run . '\x3d' . substr($run, 0, 7) . '\x27' . $run . $run
+                          . '\x3c\xe9\x3e' . substr($run, 3, 5);
+                $actual   = $escaper->escapeJs($source);
+
+                expect($actual)->equals($expected);
+
+            }
+        );
     }
 
     /**
@@ -0,0 +1,131 @@
+<?php
+/**
+ * FilterCompileTest.php
+ * \Phalcon\Text\FilterCompileTest
+ *
+ * Tests the Phalcon\Filter component
+ *
+ * Phalcon Framework
+ *
+ * @copyright (c) 2011-2014 Phalcon Team
+ * @link      http://www.phalconphp.com
+ * @author    Andres Gutierrez <andres@phalconphp.com>
+ * @author    Nikolaos Dimopoulos <nikos@phalconphp.com>
+ *
+ * The contents of this file are subject to the New BSD License that is
+ * bundled with this package in the file docs/LICENSE.txt
+ *
+ * If you did not receive a copy of the license and are unable to obtain it
+ * through the world-wide-web, please send an email to license@phalconphp.com
+ * so that we can send you a copy immediately.
+ */
+
+namespace Phalcon\Tests\unit\Phalcon\Filter;
+
+use \PhalconTest\Filter as PhTFilter;
+use \Phalcon\Filter\Exception as PhFilterException;
+
+class FilterCompileTest extends Helper\FilterBase
+{
+    /**
+     * Tests that compiled chains are cached and reused
+     *
+     * @since  2026-10-19
+     */
+    public function testCompileIsCached()
+    {
+        $this->specify(
+            "compiled chains are not reused",
+            function () {
+                $filter = new PhTFilter();
+
+                $chain = $filter->compile(['trim', 'striptags', 'lower']);
+                expect(count($chain))->equals(3);
+                expect($filter->compile(['trim', 'striptags', 'lower']))->equals($chain);
+
+                $actual = $filter->sanitize('  <b>HeLLo</b> ', ['trim', 'striptags', 'lower']);
+                expect($actual)->equals('hello');
+            }
+        );
+    }
+
+    /**
+     * Tests that adding a filter replaces the compiled chains
+     *
+     * @since  2026-10-19
+     */
+    public function testCompileUserFilterOverridesCache()
+    {
+        $this->specify(
+            "user filters are not taken into account after compiling",
+            function () {
+                $filter = new PhTFilter();
+
+                expect($filter->sanitize(' abc ', 'trim'))->equals('abc');
+
+                $filter->add('trim', function ($value) {
+                    return str_replace(' ', '_', $value);
+                });
+
+                expect($filter->sanitize(' abc ', 'trim'))->equals('_abc_');
+            }
+        );
+    }
+
+    /**
+     * Tests unknown filters
+     *
+     * @since  2026-10-19
+     */
+    public function testCompileUnknownFilter()
+    {
+        $this->specify(
+            "unknown filters do not throw an exception",
+            function () {
+                $filter = new PhTFilter();
+                $filter->compile(['trim', 'unknown']);
+            },
+            ['throws' => new PhFilterException]
+        );
+    }
+
+    /**
+     * Tests sanitizing a whole array with a schema
+     *
+     * @since  2026-10-19
+     */
+    public function testSanitizeArrayWithSchema()
+    {
+        $this->specify(
+            "array with a schema does not return the correct result",
+            function () {
+                $filter = new PhTFilter();
+
+                $data = [
+                    'name'  => ' <b>Astro</b> Boy ',
+                    'email' => "some(one)@exa\\mple.com",
+                    'age'   => '17 years',
+                    'tags'  => [' a ', 'b '],
+                    'admin' => '1'
+                ];
+
+                $expected = [
+                    'name'  => 'Astro Boy',
+                    'email' => 'someone@example.com',
+                    'age'   => 17,
+                    'tags'  => ['a', 'b']
+                ];
+
+                $actual = $filter->sanitizeArray($data, [
+                    'name'    => ['striptags', 'trim'],
+                    'email'   => 'email',
+                    'age'     => 'int!',
+                    'tags'    => 'trim',
+                    'missing' => 'trim'
+                ]);
+
+                expect($actual)->equals($expected);
+            }
+        );
+    }
+}
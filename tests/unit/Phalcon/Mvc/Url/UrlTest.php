@@ -224,6 +224,72 @@ class UrlTest extends TBase
         );
     }
 
+    /**
+     * Tests generating the same route several times
+     */
+    public function testUrlForSameRouteSeveralTimes()
+    {
+        $this->specify(
+            "URLs for the same route are not correct",
+            function () {
+
+                $di  = $this->setupDI();
+                $url = new PhTUrl();
+                $url->setDI($di);
+
+                $params = [
+                    'for'     => 'news',
+                    'country' => 'us',
+                    'section' => 'sports',
+                    'article' => 'final',
+                    'page'    => 2,
+                ];
+                expect($url->get($params))->equals('/news/us/sports/final/2');
+
+                $params['country'] = 'uk';
+                $params['page']    = 3;
+                expect($url->get($params))->equals('/news/uk/sports/final/3');
+
+                unset($params['page']);
+                expect($url->get($params))->equals('/news/uk/sports/final/');
+            }
+        );
+    }
+
+    /**
+     * Tests generating several urls for one route
+     */
+    public function testUrlGetMany()
+    {
+        $this->specify(
+            "URLs generated in batch are not correct",
+            function () {
+
+                $di  = $this->setupDI();
+                $url = new PhTUrl();
+                $url->setDI($di);
+                $url->setBaseUri('/blog/');
+
+                $expected = [
+                    'first'  => '/blog/2010/10/first-post',
+                    'second' => '/blog/2011/01/second-post',
+                ];
+                $actual   = $url->getMany(
+                    'blogPost',
+                    [
+                        'first'  => ['year' => '2010', 'month' => '10', 'title' => 'first-post'],
+                        'second' => ['year' => '2011', 'month' => '01', 'title' => 'second-post'],
+                    ]
+                );
+
+                expect($actual)->equals($expected);
+
+                $actual = $url->getMany('classApi', [['class' => 'Some']], false);
+                expect($actual)->equals(['api/classes/Some']);
+            }
+        );
+    }
+
     /**
      * Sets the environment
      */
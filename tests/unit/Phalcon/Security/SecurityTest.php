@@ -75,4 +75,69 @@ class SecurityTest extends TBase
             }
         );
     }
+
+    /**
+     * Tests the detection of hashes that must be generated again
+     */
+    public function testSecurityNeedsRehash()
+    {
+        $this->specify(
+            "The rehash detection is not correct",
+            function () {
+
+                $security = new PhTSecurity();
+                $security->setWorkFactor(5);
+
+                $hash = $security->hash('password');
+
+                expect($security->needsRehash($hash))->false();
+                expect($security->needsRehash($hash, 6))->true();
+                expect($security->needsRehash(md5('password')))->true();
+
+                $security->setWorkFactor(6);
+
+                expect($security->needsRehash($hash))->true();
+                expect($security->needsRehash($security->hash('password')))->false();
+            }
+        );
+    }
+
+    /**
+     * Tests the calibration of the work factor
+     */
+    public function testSecurityCalibrateWorkFactor()
+    {
+        $this->specify(
+            "The calibrated work factor is not correct",
+            function () {
+
+                $security = new PhTSecurity();
+
+                $workFactor = $security->calibrateWorkFactor(50);
+
+                expect($workFactor >= 4 && $workFactor <= 31)->true();
+                expect($security->getWorkFactor())->equals($workFactor);
+
+                $hash = $security->hash('password');
+                expect($security->checkHash('password', $hash))->true();
+                expect($security->needsRehash($hash))->false();
+            }
+        );
+    }
+
+    /**
+     * Tests the calibration with an invalid target time
+     */
+    public function testSecurityCalibrateWorkFactorInvalid()
+    {
+        $this->specify(
+            "The calibration does not throw with an invalid target time",
+            function () {
+
+                $security = new PhTSecurity();
+                $security->calibrateWorkFactor(0);
+            },
+            ['throws' => new \Phalcon\Security\Exception]
+        );
+    }
 }
@@ -0,0 +1,144 @@
+<?php
+/**
+ * TagCompileTest.php
+ * \Phalcon\Tag
+ *
+ * Tests the \Phalcon\Tag component
+ *
+ * Phalcon Framework
+ *
+ * @copyright (c) 2011-2015 Phalcon Team
+ * @link      http://www.phalconphp.com
+ * @author    Andres Gutierrez <andres@phalconphp.com>
+ * @author    Nikolaos Dimopoulos <nikos@phalconphp.com>
+ *
+ * The contents of this file are subject to the New BSD License that is
+ * bundled with this package in the file docs/LICENSE.txt
+ *
+ * If you did not receive a copy of the license and are unable to obtain it
+ * through the world-wide-web, please send an email to license@phalconphp.com
+ * so that we can send you a copy immediately.
+ */
+
+namespace Phalcon\Tests\unit\Phalcon\Tag;
+
+use \Phalcon\Tag\Exception as PhTagException;
+use \PhalconTest\Tag as PhTTag;
+
+class TagCompileTest extends Helper\TagBase
+{
+    /**
+     * Tests compiled helpers render the same HTML than the helpers
+     */
+    public function testCompileTextField()
+    {
+        $this->specify(
+            "compiled textField does not render the same HTML than textField",
+            function () {
+
+                PhTTag::resetInput();
+                PhTTag::setDocType(PhTTag::HTML5);
+
+                $template = PhTTag::compile(
+                    'textField',
+                    ['x_name', 'class' => 'x_class', 'size' => 30],
+                    ['value']
+                );
+
+                foreach (['x_value', '"quoted" & <b>', ''] as $value) {
+                    $expected = PhTTag::textField(
+                        ['x_name', 'class' => 'x_class', 'size' => 30, 'value' => $value]
+                    );
+                    expect($template->render(['value' => $value]))->equals($expected);
+                }
+            }
+        );
+
+        $this->specify(
+            "compile does not return the same template for the same call",
+            function () {
+
+                $template = PhTTag::compile('textField', ['x_name'], ['value']);
+                expect(PhTTag::compile('textField', ['x_name'], ['value']))->same($template);
+                expect(PhTTag::compile('textField', ['x_name'], ['class']))->notSame($template);
+            }
+        );
+    }
+
+    /**
+     * Tests submitted and default values are read when the template is rendered
+     */
+    public function testCompileReadsValueOnRender()
+    {
+        $this->specify(
+            "compiled textField does not read the value when rendered",
+            function () {
+
+                PhTTag::resetInput();
+                PhTTag::setDocType(PhTTag::HTML5);
+
+                $_POST['x_name'] = 'posted';
+                $template = PhTTag::compile('textField', ['x_name', 'class' => 'x_class'], []);
+                expect($template->render())->equals(PhTTag::textField(['x_name', 'class' => 'x_class']));
+
+                PhTTag::resetInput();
+                expect($template->render())->equals(PhTTag::textField(['x_name', 'class' => 'x_class']));
+                expect(PhTTag::compile('textField', ['x_name', 'class' => 'x_class'], [])->render())
+                    ->notContains('posted');
+
+                PhTTag::setDefault('x_name', 'default');
+                expect($template->render())->equals(PhTTag::textField(['x_name', 'class' => 'x_class']));
+
+                PhTTag::resetInput();
+            }
+        );
+
+        $this->specify(
+            "compiling checkField does not throw an exception",
+            function () {
+
+                PhTTag::compile('checkField', ['x_name', 'value' => 'Y'], []);
+            },
+            ['throws' => new PhTagException]
+        );
+    }
+
+    /**
+     * Tests compiled linkTo with a dynamic href
+     */
+    public function testCompileLinkTo()
+    {
+        $this->specify(
+            "compiled linkTo does not render the same HTML than linkTo",
+            function () {
+
+                $template = PhTTag::compile(
+                    'linkTo',
+                    ['http://phalconphp.com/', 'Phalcon', 'local' => false, 'class' => 'x_class'],
+                    ['title']
+                );
+
+                $expected = PhTTag::linkTo(
+                    ['http://phalconphp.com/', 'Phalcon', 'local' => false, 'class' => 'x_class', 'title' => 'a "title"']
+                );
+
+                expect($template->render(['title' => 'a "title"']))->equals($expected);
+            }
+        );
+    }
+
+    /**
+     * Tests attributes that are not spliced as is cannot be dynamic
+     */
+    public function testCompileInvalidAttribute()
+    {
+        $this->specify(
+            "compiling selectStatic with a dynamic value does not throw an exception",
+            function () {
+
+                PhTTag::compile('selectStatic', ['x_name', ['1' => 'A', '2' => 'B']], ['value']);
+            },
+            ['throws' => new PhTagException]
+        );
+    }
+}
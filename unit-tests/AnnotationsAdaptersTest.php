@@ -85,6 +85,71 @@ class AnnotationsAdaptersTest extends PHPUnit_Framework_TestCase
 		$this->assertEquals(get_class($classAnnotations->getClassAnnotations()), 'Phalcon\Annotations\Collection');
 	}
 
+	public function testBundleAdapter()
+	{
+		@unlink('unit-tests/annotations/cache/bundle.php');
+		@unlink('unit-tests/annotations/cache/BundleChanged.php');
+
+		$adapter = new Phalcon\Annotations\Adapter\Bundle(array(
+			'bundleFile' => 'unit-tests/annotations/cache/bundle.php'
+		));
+
+		$this->assertEquals($adapter->warm(array('TestClass', 'User\TestClassNs')), 2);
+		$this->assertTrue(file_exists('unit-tests/annotations/cache/bundle.php'));
+
+		$adapter = new Phalcon\Annotations\Adapter\Bundle(array(
+			'bundleFile' => 'unit-tests/annotations/cache/bundle.php'
+		));
+
+		$classAnnotations = $adapter->read('TestClass');
+		$this->assertTrue(is_object($classAnnotations));
+		$this->assertEquals(get_class($classAnnotations), 'Phalcon\Annotations\Reflection');
+		$this->assertEquals(get_class($classAnnotations->getClassAnnotations()), 'Phalcon\Annotations\Collection');
+
+		$classAnnotations = $adapter->get('User\TestClassNs');
+		$this->assertTrue(is_object($classAnnotations));
+		$this->assertEquals(get_class($classAnnotations), 'Phalcon\Annotations\Reflection');
+
+		$property = $adapter->getProperty('TestClass', 'testProp1');
+		$this->assertTrue(is_object($property));
+		$this->assertEquals(get_class($property), 'Phalcon\Annotations\Collection');
+		$this->assertEquals($property->count(), 4);
+
+		/**
+		 * Classes missing from the bundle are kept in memory but not persisted
+		 */
+		file_put_contents('unit-tests/annotations/cache/BundleChanged.php', "<?php\n/**\n * @Simple\n */\nclass BundleChanged {}\n");
+		require 'unit-tests/annotations/cache/BundleChanged.php';
+
+		$this->assertTrue(is_object($adapter->get('BundleChanged')));
+
+		$entries = require 'unit-tests/annotations/cache/bundle.php';
+		$this->assertFalse(isset($entries['BundleChanged']));
+		$this->assertTrue(isset($entries['TestClass']));
+
+		/**
+		 * Changing the contents of the file invalidates the entry
+		 */
+		$adapter->warm(array('TestClass', 'BundleChanged'));
+
+		file_put_contents('unit-tests/annotations/cache/BundleChanged.php', "<?php\n/**\n * @Other\n */\nclass BundleChanged {}\n");
+
+		$adapter = new Phalcon\Annotations\Adapter\Bundle(array(
+			'bundleFile' => 'unit-tests/annotations/cache/bundle.php',
+			'validate' => false
+		));
+		$this->assertTrue(is_object($adapter->read('BundleChanged')));
+
+		$adapter = new Phalcon\Annotations\Adapter\Bundle(array(
+			'bundleFile' => 'unit-tests/annotations/cache/bundle.php'
+		));
+		$this->assertFalse($adapter->read('BundleChanged'));
+		$this->assertTrue(is_object($adapter->read('TestClass')));
+
+		@unlink('unit-tests/annotations/cache/bundle.php');
+		@unlink('unit-tests/annotations/cache/BundleChanged.php');
+	}
+
 	public function testApcAdapter()
 	{
 		if (!function_exists('apc_fetch')) {
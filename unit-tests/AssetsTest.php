@@ -225,6 +225,9 @@ class AssetsTest extends PHPUnit_Framework_TestCase
 
 		$filtered = $jsmin->filter("\t\ta\t\r\n= \n \r\n100;\t");
 		$this->assertEquals($filtered, "\n" . 'a=100;');
+
+		$filtered = $jsmin->filter("var s = 'café'; // ü\nvar t = \"ñ\";");
+		$this->assertEquals($filtered, "\n" . "var s='café';var t=\"ñ\";");
 	}
 
 	public function testCssminFilter()
@@ -272,6 +275,29 @@ class AssetsTest extends PHPUnit_Framework_TestCase
 
 		$filtered = $cssmin->filter(".navbar .nav>li>a { color: #111; text-decoration: underline; }");
 		$this->assertEquals($filtered, ".navbar .nav>li>a{color: #111;text-decoration: underline;}");
+
+		$filtered = $cssmin->filter("a{color: red;}/* links */b{color: blue;}");
+		$this->assertEquals($filtered, "a{color: red}b{color: blue}");
+	}
+
+	public function testMinifyFile()
+	{
+		$target = __DIR__ . '/assets/production/jquery.min.js';
+		@unlink($target);
+
+		$jsmin = new Phalcon\Assets\Filters\Jsmin();
+		$this->assertTrue($jsmin->filterFile(__DIR__ . '/assets/jquery.js', $target));
+		$this->assertEquals(file_get_contents($target), $jsmin->filter(file_get_contents(__DIR__ . '/assets/jquery.js')));
+
+		$target = __DIR__ . '/assets/production/1198.min.css';
+		@unlink($target);
+
+		$cssmin = new Phalcon\Assets\Filters\Cssmin();
+		$this->assertTrue($cssmin->filterFile(__DIR__ . '/assets/1198.css', $target));
+		$this->assertEquals(file_get_contents($target), $cssmin->filter(file_get_contents(__DIR__ . '/assets/1198.css')));
+
+		@unlink(__DIR__ . '/assets/production/jquery.min.js');
+		@unlink($target);
 	}
 
 	public function testNoneFilter()
@@ -548,4 +574,102 @@ class AssetsTest extends PHPUnit_Framework_TestCase
 		$this->assertEquals($assets->outputJs('js'), '<script type="text/javascript" src="//phalconphp.com/js/jquery.js"></script>' . PHP_EOL);
 	}
 
+	public function testBuildManifest()
+	{
+		$content = 'A{TEXT-DECORATION:NONE;}B{FONT-WEIGHT:BOLD;}';
+		$hash = substr(md5($content), 0, 8);
+		$manifestPath = __DIR__ . '/assets/production/manifest.php';
+
+		@unlink(__DIR__ . '/assets/production/build.' . $hash . '.css');
+		@unlink($manifestPath);
+
+		$di = new \Phalcon\DI\FactoryDefault();
+		$di['url']->setStaticBaseUri('/');
+
+		$assets = new \Phalcon\Assets\Manager();
+		$assets->useImplicitOutput(false);
+		$assets->collection('css')
+			->setTargetPath(__DIR__ . '/assets/production/build.css')
+			->setTargetUri('production/build.css')
+			->addCss(__DIR__ . '/assets/1198.css')
+			->addFilter(new UppercaseFilter())
+			->addFilter(new TrimFilter())
+			->join(true);
+		$assets->collection('remote')
+			->addJs('http://code.jquery.com/jquery-1.11.1.min.js', false, false);
+
+		$manifest = $assets->build($manifestPath);
+
+		//Collections without filters are not built
+		$this->assertEquals(array_keys($manifest), array('css'));
+		$this->assertEquals($manifest['css'][0][0], 'production/build.' . $hash . '.css');
+		$this->assertEquals(file_get_contents(__DIR__ . '/assets/production/build.' . $hash . '.css'), $content);
+		$this->assertEquals(fileperms(__DIR__ . '/assets/production/build.' . $hash . '.css') & 0777, 0666 & ~umask());
+		$this->assertFalse(file_exists(__DIR__ . '/assets/production/build.css'));
+
+		$html = '<link rel="stylesheet" type="text/css" href="/production/build.' . $hash . '.css" />' . PHP_EOL;
+		$this->assertEquals($assets->outputCss(), $html);
+
+		//The manifest is used by a new manager without touching the sources
+		$assets = new \Phalcon\Assets\Manager();
+		$assets->useImplicitOutput(false);
+		$assets->collection('css')
+			->setTargetPath(__DIR__ . '/assets/production/build.css')
+			->addCss(__DIR__ . '/assets/missing.css')
+			->addFilter(new UppercaseFilter());
+		$assets->collection('remote')
+			->addJs('http://code.jquery.com/jquery-1.11.1.min.js', false, false);
+
+		$this->assertTrue($assets->loadManifest($manifestPath));
+		$this->assertEquals($assets->outputCss('css'), $html);
+		$this->assertEquals($assets->outputJs('remote'), '<script type="text/javascript" src="http://code.jquery.com/jquery-1.11.1.min.js"></script>' . PHP_EOL);
+
+		@unlink(__DIR__ . '/assets/production/build.' . $hash . '.css');
+		@unlink($manifestPath);
+
+		//The filtered content can't overwrite the source of a resource
+		$resource = new \Phalcon\Assets\Resource\Css(__DIR__ . '/assets/1198.css');
+		$resource->setTargetPath(__DIR__ . '/assets/1198.css');
+
+		$assets = new \Phalcon\Assets\Manager();
+		$assets->collection('css')
+			->add($resource)
+			->addFilter(new UppercaseFilter());
+
+		try {
+			$assets->build();
+			$this->fail('Building over the source must fail');
+		} catch (\Phalcon\Assets\Exception $e) {
+			$this->assertEquals($e->getMessage(), "Resource '" . realpath(__DIR__ . '/assets/1198.css') . "' have the same source and target paths");
+		}
+	}
+
+	public function testBuildCompressed()
+	{
+		$content = 'A{TEXT-DECORATION:NONE;}B{FONT-WEIGHT:BOLD;}';
+		$path = __DIR__ . '/assets/production/compressed.' . substr(md5($content), 0, 8) . '.css';
+
+		@unlink($path);
+		@unlink($path . '.gz');
+
+		$assets = new \Phalcon\Assets\Manager();
+		$assets->addCompressor(new \Phalcon\Assets\Compressors\Gzip());
+		$assets->collection('css')
+			->setTargetPath(__DIR__ . '/assets/production/compressed.css')
+			->setTargetUri('production/compressed.css')
+			->addCss(__DIR__ . '/assets/1198.css')
+			->addFilter(new UppercaseFilter())
+			->addFilter(new TrimFilter());
+
+		$this->assertEquals(count($assets->getCompressors()), 1);
+
+		$assets->build();
+
+		$this->assertEquals(file_get_contents($path), $content);
+		$this->assertEquals(gzdecode(file_get_contents($path . '.gz')), $content);
+
+		@unlink($path);
+		@unlink($path . '.gz');
+	}
+
 }
@@ -93,4 +93,136 @@ class BeanstalkTest extends PHPUnit_Framework_TestCase
 
 		$this->assertTrue($job->delete());
 	}
+
+	public function testPutManyReserveLoop()
+	{
+		$queue = new Phalcon\Queue\Beanstalk();
+		try {
+			@$queue->connect();
+		}
+		catch (Exception $e) {
+			$this->markTestSkipped($e->getMessage());
+			return;
+		}
+
+		$this->assertTrue($queue->choose('beanstalk-pipeline') !== false);
+		$this->assertTrue($queue->watch('beanstalk-pipeline') !== false);
+
+		$ids = $queue->putMany(array(
+			'first'  => array('data' => array('processVideo' => 1)),
+			'second' => array('data' => array('processVideo' => 2), 'options' => array('priority' => 50)),
+			'third'  => array('data' => 'doSomething')
+		), array('ttr' => 60));
+
+		$this->assertEquals(array('first', 'second', 'third'), array_keys($ids));
+		foreach ($ids as $id) {
+			$this->assertTrue($id !== false);
+		}
+
+		$this->assertEquals(array(), $queue->putMany(array()));
+
+		$bodies = array();
+		$processed = $queue->reserveLoop(function($job) use (&$bodies) {
+			$bodies[] = $job->getBody();
+			$job->delete();
+		}, 0, 3);
+
+		$this->assertEquals(3, $processed);
+
+		// The job with the lowest priority value is reserved first
+		$this->assertEquals(array('processVideo' => 2), $bodies[0]);
+		$this->assertContains(array('processVideo' => 1), $bodies);
+		$this->assertContains('doSomething', $bodies);
+
+		// Nothing left in the tube, the loop ends on timeout
+		$this->assertEquals(0, $queue->reserveLoop(function($job) {
+			$job->delete();
+		}, 0));
+	}
+
+	public function testPutManyLargeBatch()
+	{
+		$queue = new Phalcon\Queue\Beanstalk();
+		try {
+			@$queue->connect();
+		}
+		catch (Exception $e) {
+			$this->markTestSkipped($e->getMessage());
+			return;
+		}
+
+		$this->assertTrue($queue->choose('beanstalk-pipeline-large') !== false);
+		$this->assertTrue($queue->watch('beanstalk-pipeline-large') !== false);
+
+		// Several chunks larger than the socket buffers
+		$jobs = array();
+		for ($i = 0; $i < 2000; $i++) {
+			$jobs[] = array('data' => str_repeat('x', 1024) . $i);
+		}
+
+		$ids = $queue->putMany($jobs);
+		$this->assertEquals(2000, count($ids));
+		foreach ($ids as $id) {
+			$this->assertTrue($id !== false);
+		}
+
+		$this->assertEquals(2000, $queue->reserveLoop(function($job) {
+			$job->delete();
+		}, 0));
+	}
+
+	/**
+	 * @expectedException Phalcon\Exception
+	 */
+	public function testPutManyInvalidJob()
+	{
+		$queue = new Phalcon\Queue\Beanstalk();
+		$queue->putMany(array('processVideo'));
+	}
+
+	public function testSerializers()
+	{
+		$queue = new Phalcon\Queue\Beanstalk(array('serializer' => 'json'));
+		$this->assertEquals('json', $queue->getSerializer());
+		$this->assertEquals('{"processVideo":4871}', $queue->encode(array('processVideo' => 4871)));
+		$this->assertEquals(array('processVideo' => 4871), $queue->decode('{"processVideo":4871}'));
+
+		$queue->setSerializer('raw');
+		$this->assertEquals('processVideo', $queue->encode('processVideo'));
+		$this->assertEquals('processVideo', $queue->decode('processVideo'));
+
+		$queue->setSerializer(array(
+			'serialize'   => 'base64_encode',
+			'unserialize' => 'base64_decode'
+		));
+		$this->assertEquals('cHJvY2Vzc1ZpZGVv', $queue->encode('processVideo'));
+		$this->assertEquals('processVideo', $queue->decode('cHJvY2Vzc1ZpZGVv'));
+
+		$queue = new Phalcon\Queue\Beanstalk();
+		$this->assertEquals('php', $queue->getSerializer());
+		$this->assertEquals(array(1, 2), $queue->decode($queue->encode(array(1, 2))));
+	}
+
+	/**
+	 * @expectedException Phalcon\Exception
+	 */
+	public function testUnknownSerializer()
+	{
+		new Phalcon\Queue\Beanstalk(array('serializer' => 'yaml'));
+	}
+
+	public function testLazyBody()
+	{
+		$queue = new Phalcon\Queue\Beanstalk(array('serializer' => 'json'));
+		$job = new Phalcon\Queue\Beanstalk\Job($queue, '1', null, '{"processVideo":4871}');
+
+		$this->assertEquals('{"processVideo":4871}', $job->getRawBody());
+		$this->assertEquals(array('processVideo' => 4871), $job->getBody());
+
+		// The third argument is still the decoded body
+		$job = new Phalcon\Queue\Beanstalk\Job($queue, '1', array('processVideo' => 4871));
+
+		$this->assertEquals(array('processVideo' => 4871), $job->getBody());
+		$this->assertEquals('{"processVideo":4871}', $job->getRawBody());
+	}
 }
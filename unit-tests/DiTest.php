@@ -395,4 +395,129 @@ class DiTest extends PHPUnit_Framework_TestCase
 		$this->assertTrue($di->getService('resolved')->isResolved());
 		$this->assertFalse($di->getService('notresolved')->isResolved());
 	}
+
+	public function testCompile()
+	{
+		@unlink('unit-tests/cache/di-compiled.php');
+
+		$di = new \Phalcon\Di();
+
+		$response = new Phalcon\Http\Response();
+		$di->set('response', $response);
+
+		$di->set('complexConstructor', array(
+			'className' => 'InjectableComponent',
+			'arguments' => array(
+				array('type' => 'service', 'name' => 'response')
+			)
+		));
+
+		$di->set('complexSetters', array(
+			'className' => 'InjectableComponent',
+			'calls' => array(
+				array(
+					'method' => 'setResponse',
+					'arguments' => array(
+						array('type' => 'parameter', 'value' => 'response')
+					)
+				)
+			),
+			'properties' => array(
+				array('name' => 'other', 'value' => array('type' => 'parameter', 'value' => array(1, 2)))
+			)
+		));
+
+		// Definitions with objects cannot be compiled
+		$di->set('notCompiled', array(
+			'className' => 'SomeComponent',
+			'arguments' => array(
+				array('type' => 'parameter', 'value' => $response)
+			)
+		));
+
+		$this->assertEquals(2, $di->compile('unit-tests/cache/di-compiled.php'));
+		$this->assertTrue(file_exists('unit-tests/cache/di-compiled.php'));
+
+		$this->assertInstanceOf('Closure', $di->getService('complexConstructor')->getCompiled());
+		$this->assertNull($di->getService('notCompiled')->getCompiled());
+
+		$component = $di->get('complexConstructor');
+		$this->assertSame($response, $component->getResponse());
+
+		$component = $di->get('complexSetters');
+		$this->assertEquals('response', $component->getResponse());
+		$this->assertEquals(array(1, 2), $component->other);
+
+		$component = $di->get('complexConstructor', array('parameter'));
+		$this->assertEquals('parameter', $component->getResponse());
+
+		$component = $di->get('notCompiled');
+		$this->assertSame($response, $component->someProperty);
+
+		// Changing a parameter discards the compiled closure
+		$di->getService('complexConstructor')->setParameter(0, array('type' => 'parameter', 'value' => 'updated'));
+		$this->assertNull($di->getService('complexConstructor')->getCompiled());
+		$this->assertEquals('updated', $di->get('complexConstructor')->getResponse());
+
+		// A fresh container reuses the compiled file while definitions don't change
+		$di = new \Phalcon\Di();
+		$di->set('complexConstructor', array(
+			'className' => 'InjectableComponent',
+			'arguments' => array(
+				array('type' => 'parameter', 'value' => 'changed')
+			)
+		));
+		$di->set('complexSetters', array(
+			'className' => 'InjectableComponent',
+			'calls' => array(
+				array(
+					'method' => 'setResponse',
+					'arguments' => array(
+						array('type' => 'parameter', 'value' => 'response')
+					)
+				)
+			),
+			'properties' => array(
+				array('name' => 'other', 'value' => array('type' => 'parameter', 'value' => array(1, 2)))
+			)
+		));
+
+		$this->assertTrue($di->loadCompiled('unit-tests/cache/di-compiled.php'));
+		$this->assertNull($di->getService('complexConstructor')->getCompiled());
+		$this->assertInstanceOf('Closure', $di->getService('complexSetters')->getCompiled());
+		$this->assertEquals('changed', $di->get('complexConstructor')->getResponse());
+
+		$this->assertFalse($di->loadCompiled('unit-tests/cache/unknown.php'));
+
+		@unlink('unit-tests/cache/di-compiled.php');
+	}
+
+	public function testResetRequestScope()
+	{
+		$di = new Phalcon\Di\FactoryDefault();
+
+		$this->assertTrue($di->isRequestScoped('request'));
+		$this->assertFalse($di->isRequestScoped('router'));
+
+		$request = $di->getShared('request');
+		$response = $di->get('response');
+		$router = $di->getShared('router');
+		$instance = $di->getShared('stdClass');
+
+		$di->setRequestScoped('escaper');
+		$this->assertTrue(in_array('escaper', $di->getRequestScoped()));
+
+		$di->resetRequestScope();
+
+		$this->assertNotSame($request, $di->getShared('request'));
+		$this->assertNotSame($response, $di->get('response'));
+		$this->assertSame($router, $di->getShared('router'));
+		$this->assertNotSame($instance, $di->getShared('stdClass'));
+
+		$this->assertNull($di->getResolvedShared('escaper'));
+		$this->assertSame($router, $di->getResolvedShared('router'));
+
+		$di->setRequestScoped('escaper', false);
+		$this->assertFalse($di->isRequestScoped('escaper'));
+	}
 }
@@ -193,4 +193,65 @@ class DispatcherMvcTest extends PHPUnit_Framework_TestCase
 		$this->assertEquals($value, 'index');
 	}
 
+	public function testDispatcherHandlersCache()
+	{
+		Phalcon\DI::reset();
+		Phalcon\Mvc\Dispatcher::resetHandlersCache();
+
+		$di = new Phalcon\Di();
+		$di->set('response', new \Phalcon\Http\Response());
+
+		$dispatcher = new Phalcon\Mvc\Dispatcher();
+		$dispatcher->setDI($di);
+		$di->set('dispatcher', $dispatcher);
+
+		// Resolutions are reused in later dispatches
+		for ($i = 0; $i < 3; $i++) {
+			$dispatcher->setControllerName('test2');
+			$dispatcher->setActionName('anotherTwo');
+			$dispatcher->setParams(array(2, "3"));
+			$this->assertInstanceOf('Test2Controller', $dispatcher->dispatch());
+			$this->assertEquals(5, $dispatcher->getReturnedValue());
+		}
+
+		// Missing actions are still detected with a warm cache
+		$dispatcher->setControllerName('test2');
+		$dispatcher->setActionName('essai');
+		$dispatcher->setParams(array());
+
+		try {
+			$dispatcher->dispatch();
+			$this->assertTrue(FALSE, 'oh, Why?');
+		} catch (Phalcon\Exception $e) {
+			$this->assertEquals($e->getMessage(), "Action 'essai' was not found on handler 'test2'");
+		}
+
+		// Services registered in the DI take precedence over cached classes
+		$di = new Phalcon\Di();
+		$di->set('response', new \Phalcon\Http\Response());
+		$di->set('dispatcher', $dispatcher);
+		$di->set('Test2Controller', 'Test3Controller');
+		$dispatcher->setDI($di);
+
+		$dispatcher->setControllerName('test2');
+		$dispatcher->setActionName('other');
+		$dispatcher->setParams(array());
+		$this->assertInstanceOf('Test3Controller', $dispatcher->dispatch());
+
+		// A class resolved through the DI is still autoloaded by a container without the service
+		Phalcon\Mvc\Dispatcher::resetHandlersCache();
+		$this->assertInstanceOf('Test3Controller', $dispatcher->dispatch());
+
+		$di = new Phalcon\Di();
+		$di->set('response', new \Phalcon\Http\Response());
+		$di->set('dispatcher', $dispatcher);
+		$dispatcher->setDI($di);
+
+		$dispatcher->setControllerName('test2');
+		$dispatcher->setActionName('other');
+		$dispatcher->setParams(array());
+		$this->assertInstanceOf('Test2Controller', $dispatcher->dispatch());
+
+		Phalcon\Mvc\Dispatcher::resetHandlersCache();
+	}
 }
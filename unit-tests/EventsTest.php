@@ -421,4 +421,37 @@ class EventsTest extends PHPUnit_Framework_TestCase
 		$this->assertInstanceOf('MySecondWeakrefListener', $logListeners[0]);
 		$this->assertCount(1, $logListeners);
 	}
+
+	public function testEventsPriorityOrderAndFastPath()
+	{
+		$eventsManager = new Phalcon\Events\Manager();
+		$eventsManager->enablePriorities(true);
+
+		$this->assertNull($eventsManager->fire('some-type:beforeSome', $this));
+
+		$order = array();
+		$eventsManager->attach('some-type', function() use (&$order) { $order[] = 'low'; }, 10);
+		$eventsManager->attach('some-type', function() use (&$order) { $order[] = 'high'; }, 200);
+		$eventsManager->attach('some-type:beforeSome', function() use (&$order) { $order[] = 'named'; return 'done'; });
+
+		// No listeners for other types or event names
+		$this->assertNull($eventsManager->fire('other-type:beforeSome', $this));
+
+		$this->assertEquals('done', $eventsManager->fire('some-type:beforeSome', $this));
+		$this->assertEquals(array('high', 'low', 'named'), $order);
+
+		// Listeners attached after a fire are taken into account
+		$order = array();
+		$eventsManager->attach('some-type', function() use (&$order) { $order[] = 'middle'; }, 100);
+		$eventsManager->fire('some-type:afterSome', $this);
+		$this->assertEquals(array('high', 'middle', 'low'), $order);
+
+		// The queue of listeners is kept intact
+		$this->assertCount(3, $eventsManager->getListeners('some-type'));
+
+		$order = array();
+		$eventsManager->detachAll('some-type');
+		$eventsManager->fire('some-type:afterSome', $this);
+		$this->assertEquals(array(), $order);
+	}
 }
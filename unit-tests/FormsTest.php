@@ -316,6 +316,50 @@ class FormsTest extends PHPUnit_Framework_TestCase
 		)));
 	}
 
+	public function testFormValidatorCancelOnFail()
+	{
+		$telephone = new Text('telephone');
+		$telephone->addValidators(array(
+			new PresenceOf(array(
+				'message' => 'The telephone is required',
+				'cancelOnFail' => true
+			)),
+			new StringLength(array(
+				'min' => 5,
+				'messageMinimum' => 'The telephone is too short'
+			))
+		));
+
+		$address = new Text('address');
+		$address->addValidator(new PresenceOf(array(
+			'message' => 'The address is required'
+		)));
+
+		$form = new Form();
+		$form->add($telephone);
+		$form->add($address);
+
+		//A failed validator with 'cancelOnFail' only cancels the validators of its element
+		$this->assertFalse($form->isValid(array()));
+
+		$messages = $form->getMessages(true);
+		$this->assertEquals(count($messages), 2);
+		$this->assertEquals(count($messages['telephone']), 1);
+		$this->assertEquals($messages['telephone'][0]->getMessage(), 'The telephone is required');
+		$this->assertEquals(count($messages['address']), 1);
+		$this->assertEquals($messages['address'][0]->getMessage(), 'The address is required');
+
+		$this->assertEquals(count($form->getMessagesFor('telephone')), 1);
+		$this->assertEquals(count($form->getMessagesFor('address')), 1);
+
+		//The same form validates again with the validation it already built
+		$this->assertFalse($form->isValid(array('telephone' => '123', 'address' => 'hello')));
+		$this->assertEquals(count($form->getMessagesFor('telephone')), 1);
+		$this->assertEquals($form->getMessagesFor('telephone')->offsetGet(0)->getType(), 'TooShort');
+
+		$this->assertTrue($form->isValid(array('telephone' => '12345', 'address' => 'hello')));
+	}
+
 	public function testFormRenderEntity()
 	{
 		//Second element
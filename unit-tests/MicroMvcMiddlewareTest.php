@@ -142,4 +142,45 @@ class MicroMvcMiddlewareTest extends PHPUnit_Framework_TestCase
 		$this->assertEquals($middleware->getNumber(), 3);
 	}
 
+	public function testMicroMiddlewareAppendedAfterHandle()
+	{
+
+		$app = new Phalcon\Mvc\Micro();
+
+		$app->map('/api/site', function(){
+			return true;
+		});
+
+		$trace = 0;
+
+		$app->before(function() use (&$trace) {
+			$trace++;
+		});
+
+		$app->handle('/api/site');
+
+		$this->assertEquals($trace, 1);
+
+		$app->before(function() use (&$trace) {
+			$trace += 10;
+		});
+
+		$app->finish(function() use (&$trace) {
+			$trace += 100;
+		});
+
+		$app->handle('/api/site');
+
+		$this->assertEquals($trace, 112);
+
+		$app->after('not-a-callable');
+
+		try {
+			$app->handle('/api/site');
+			$this->assertTrue(false);
+		} catch (Phalcon\Mvc\Micro\Exception $e) {
+			$this->assertEquals($e->getMessage(), "One of the 'after' handlers is not callable");
+		}
+	}
+
 }
@@ -127,4 +127,42 @@ class MicroMvcTest extends PHPUnit_Framework_TestCase
 		$this->assertTrue($flag);
 	}
 
+	public function testMicroReset()
+	{
+		$di = new \Phalcon\Di\FactoryDefault();
+		$app = new \Phalcon\Mvc\Micro($di);
+
+		$app->get('/api/site/{id}', function ($id) use ($app) {
+			$app->response->setContent($id);
+			return $app->response;
+		});
+
+		$_SERVER['REQUEST_METHOD'] = 'GET';
+
+		ob_start();
+		$first = $app->handle('/api/site/1');
+		ob_end_clean();
+
+		$router = $di->getShared('router');
+
+		$app->reset();
+
+		$this->assertNull($app->getActiveHandler());
+		$this->assertNull($app->getReturnedValue());
+
+		ob_start();
+		$second = $app->handle('/api/site/2');
+		ob_end_clean();
+
+		$this->assertNotSame($first, $second);
+		$this->assertEquals($first->getContent(), '1');
+		$this->assertEquals($second->getContent(), '2');
+		$this->assertSame($router, $di->getShared('router'));
+
+		// Services that were never used are not built by the reset
+		$app->reset();
+		$this->assertNull($di->getResolvedShared('modelsManager'));
+		$this->assertSame($app->response, $di->getShared('response'));
+	}
+
 }
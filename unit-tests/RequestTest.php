@@ -379,4 +379,111 @@ class RequestTest extends PHPUnit_Framework_TestCase
 
 		$this->assertEquals($request->getHeaders(), $headers);
 	}
+
+	protected function _jsonStream($json, $associative = false, $chunkSize = 8192)
+	{
+		$stream = fopen('php://memory', 'w+b');
+		fwrite($stream, $json);
+		rewind($stream);
+		return new Phalcon\Http\Request\JsonStream($stream, $associative, $chunkSize);
+	}
+
+	public function testJsonStream()
+	{
+		$json = ' [ {"name": "Astro Boy", "tags": ["a", "b]"], "quote": "say \\"hi\\", {x}"}, 10, "text", null, [1, [2, 3]] ] ';
+
+		// Small chunks force elements to span several reads
+		foreach (array(1, 3, 8192) as $chunkSize) {
+			$items = array();
+			foreach ($this->_jsonStream($json, true, $chunkSize) as $key => $item) {
+				$items[$key] = $item;
+			}
+			$this->assertEquals(json_decode($json, true), $items);
+		}
+
+		$stream = $this->_jsonStream('[{"name": "Astro Boy"}]');
+		foreach ($stream as $item) {
+			$this->assertInstanceOf('stdClass', $item);
+			$this->assertEquals('Astro Boy', $item->name);
+		}
+
+		$this->assertEquals(array(), iterator_to_array($this->_jsonStream('[]')));
+	}
+
+	/**
+	 * @expectedException Phalcon\Http\Request\Exception
+	 */
+	public function testJsonStreamNotArray()
+	{
+		iterator_to_array($this->_jsonStream('{"name": "Astro Boy"}'));
+	}
+
+	/**
+	 * @expectedException Phalcon\Http\Request\Exception
+	 */
+	public function testJsonStreamTruncated()
+	{
+		iterator_to_array($this->_jsonStream('[{"name": "Astro'));
+	}
+
+	public function testRawBodyStream()
+	{
+		$request = new Phalcon\Http\Request();
+		$stream = $request->getRawBodyStream(1024);
+		$this->assertTrue(is_resource($stream));
+		$this->assertEquals('', stream_get_contents($stream));
+	}
+
+	public function testHeadersAreParsedOnce()
+	{
+		$_SERVER['HTTP_X_CUSTOM_HEADER'] = 'first';
+
+		$request = new \Phalcon\Http\Request();
+		$headers = $request->getHeaders();
+		$this->assertEquals('first', $headers['X-Custom-Header']);
+
+		// The map is a snapshot taken on the first access
+		$_SERVER['HTTP_X_CUSTOM_HEADER'] = 'second';
+		$headers = $request->getHeaders();
+		$this->assertEquals('first', $headers['X-Custom-Header']);
+
+		unset($_SERVER['HTTP_X_CUSTOM_HEADER']);
+	}
+
+	public function testHeaderLookupIsCaseInsensitive()
+	{
+		$_SERVER['HTTP_X_CUSTOM_HEADER'] = 'first';
+		$_SERVER['CONTENT_TYPE'] = 'application/json';
+
+		$request = new \Phalcon\Http\Request();
+
+		$this->assertEquals('first', $request->getHeader('X-Custom-Header'));
+		$this->assertEquals('first', $request->getHeader('x-custom-header'));
+		$this->assertEquals('first', $request->getHeader('X_CUSTOM_HEADER'));
+		$this->assertEquals('application/json', $request->getHeader('content-type'));
+		$this->assertEquals('', $request->getHeader('X-Unknown'));
+
+		// getHeader() and getHeaders() read the same snapshot
+		$_SERVER['HTTP_X_CUSTOM_HEADER'] = 'second';
+		$headers = $request->getHeaders();
+		$this->assertEquals($headers['X-Custom-Header'], $request->getHeader('x-Custom-header'));
+
+		unset($_SERVER['HTTP_X_CUSTOM_HEADER'], $_SERVER['CONTENT_TYPE']);
+	}
+
+	public function testQualityHeadersAreMemoized()
+	{
+		$request = new \Phalcon\Http\Request();
+
+		$_SERVER['HTTP_ACCEPT_LANGUAGE'] = 'es,en;q=0.5';
+		$this->assertEquals('es', $request->getBestLanguage());
+		$this->assertEquals($request->getLanguages(), $request->getLanguages());
+
+		// A different header value is parsed again
+		$_SERVER['HTTP_ACCEPT_LANGUAGE'] = 'es;q=0.3,en';
+		$this->assertEquals('en', $request->getBestLanguage());
+		$this->assertCount(2, $request->getLanguages());
+
+		unset($_SERVER['HTTP_ACCEPT_LANGUAGE']);
+	}
 }
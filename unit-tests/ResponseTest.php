@@ -200,6 +200,157 @@ class ResponseTest extends PHPUnit_Framework_TestCase
 		$this->assertEquals($this->_response->isSent(), true);
 	}
 
+	public function testSetFileToSendConditional()
+	{
+		$filename = __FILE__;
+		$etag = '"' . dechex(filesize($filename)) . '-' . dechex(filemtime($filename)) . '"';
+
+		$this->_response->resetHeaders();
+		$this->_response->setFileToSend($filename, null, false, array('etag' => true));
+
+		$headers = $this->_response->getHeaders();
+		$this->assertEquals($etag, $headers->get('Etag'));
+		$this->assertEquals(gmdate('D, d M Y H:i:s', filemtime($filename)) . ' GMT', $headers->get('Last-Modified'));
+
+		$_SERVER['HTTP_IF_NONE_MATCH'] = 'W/"abc", ' . $etag;
+
+		$this->_response->resetHeaders();
+		$this->_response->setFileToSend($filename, null, false, array('etag' => true));
+		$this->assertEquals('304 Not modified', $this->_response->getHeaders()->get('Status'));
+
+		ob_start();
+		$this->_response->send();
+		$this->assertEquals('', ob_get_clean());
+
+		unset($_SERVER['HTTP_IF_NONE_MATCH']);
+	}
+
+	public function testSetFileToSendRanges()
+	{
+		$filename = __FILE__;
+		$size = filesize($filename);
+		$content = file_get_contents($filename);
+
+		$_SERVER['HTTP_RANGE'] = 'bytes=10-19';
+
+		$response = new Phalcon\Http\Response();
+		$response->setFileToSend($filename, null, false, array('ranges' => true));
+
+		$headers = $response->getHeaders();
+		$this->assertEquals('206 Partial Content', $headers->get('Status'));
+		$this->assertEquals('bytes 10-19/' . $size, $headers->get('Content-Range'));
+		$this->assertEquals(10, $headers->get('Content-Length'));
+
+		ob_start();
+		$response->send();
+		$this->assertEquals(substr($content, 10, 10), ob_get_clean());
+
+		$_SERVER['HTTP_RANGE'] = 'bytes=0-4,-5';
+
+		$response = new Phalcon\Http\Response();
+		$response->setFileToSend($filename, null, false, array('ranges' => true));
+
+		$headers = $response->getHeaders();
+		$this->assertEquals(1, preg_match('/^multipart\/byteranges; boundary=([a-f0-9]+)$/', $headers->get('Content-Type'), $matches));
+
+		ob_start();
+		$response->send();
+		$body = ob_get_clean();
+
+		$boundary = $matches[1];
+		$expected = "\r\n--" . $boundary . "\r\nContent-Type: application/octet-stream\r\nContent-Range: bytes 0-4/" . $size . "\r\n\r\n" . substr($content, 0, 5) .
+			"\r\n--" . $boundary . "\r\nContent-Type: application/octet-stream\r\nContent-Range: bytes " . ($size - 5) . "-" . ($size - 1) . "/" . $size . "\r\n\r\n" . substr($content, -5) .
+			"\r\n--" . $boundary . "--\r\n";
+
+		$this->assertEquals($expected, $body);
+		$this->assertEquals(strlen($expected), $headers->get('Content-Length'));
+
+		$_SERVER['HTTP_RANGE'] = 'bytes=' . ($size + 10) . '-';
+
+		$response = new Phalcon\Http\Response();
+		$response->setFileToSend($filename, null, false, array('ranges' => true));
+
+		$headers = $response->getHeaders();
+		$this->assertEquals('416 Requested range not satisfiable', $headers->get('Status'));
+		$this->assertEquals('bytes */' . $size, $headers->get('Content-Range'));
+
+		unset($_SERVER['HTTP_RANGE']);
+	}
+
+	public function testSetFileToSendOffload()
+	{
+		$this->_response->resetHeaders();
+		$this->_response->setFileToSend(__FILE__, 'test.php', true, array(
+			'offload'     => 'X-Accel-Redirect',
+			'offloadPath' => '/protected/test.php'
+		));
+
+		$this->assertEquals('/protected/test.php', $this->_response->getHeaders()->get('X-Accel-Redirect'));
+
+		ob_start();
+		$this->_response->send();
+		$this->assertEquals('', ob_get_clean());
+	}
+
+	public function testStreamedContent()
+	{
+		$flushes = array();
+		$output = '';
+
+		ob_start(function($buffer) use (&$output, &$flushes) {
+			if (strlen($buffer)) {
+				$flushes[] = $buffer;
+				$output .= $buffer;
+			}
+			return '';
+		});
+
+		$response = new Phalcon\Http\Response();
+		$response->setStreamedContent(new ArrayIterator(array('abcd', 'efgh', 'ijkl')), 8, true);
+		$response->send();
+
+		ob_end_clean();
+
+		$this->assertEquals('abcdefghijkl', $output);
+		$this->assertEquals(array('abcdefgh', 'ijkl'), $flushes);
+		$this->assertTrue($response->isSent());
+
+		// Buffers opened by the application aren't flushed by default
+		$chunks = array('first,', 'second');
+
+		ob_start();
+		$response = new Phalcon\Http\Response();
+		$response->setStreamedContent(function() use (&$chunks) {
+			return array_shift($chunks);
+		});
+		$response->send();
+		$this->assertEquals('first,second', ob_get_clean());
+	}
+
+	public function testJsonStreamedContent()
+	{
+		ob_start();
+		$response = new Phalcon\Http\Response();
+		$response->setJsonStreamedContent(array(array('id' => 1), array('id' => 2), 'three'), 0, 4);
+		$response->send();
+		$this->assertEquals('[{"id":1},{"id":2},"three"]', ob_get_clean());
+
+		ob_start();
+		$response = new Phalcon\Http\Response();
+		$response->setJsonStreamedContent(array());
+		$response->send();
+		$this->assertEquals('[]', ob_get_clean());
+	}
+
+	/**
+	 * @expectedException Phalcon\Http\Response\Exception
+	 */
+	public function testStreamedContentInvalidProducer()
+	{
+		$response = new Phalcon\Http\Response();
+		$response->setStreamedContent('not a producer');
+	}
+
 	public function testMultipleHttpHeadersBug1892()
 	{
 		$this->_response->resetHeaders();
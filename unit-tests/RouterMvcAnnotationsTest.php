@@ -222,4 +222,64 @@ class RouterMvcAnnotationsTest extends PHPUnit_Framework_TestCase
 			$this->assertEquals($router->isExactControllerName(), true);
 		}
 	}
+
+	public function testRouterRoutesCache()
+	{
+		$cache = new Phalcon\Cache\Backend\Memory(new Phalcon\Cache\Frontend\Data());
+
+		$router = new Phalcon\Mvc\Router\Annotations(false);
+		$router->setDI($this->_getDI());
+		$router->setRoutesCache($cache);
+		$router->addResource('Robots', '/');
+		$router->addResource('Products', '/products');
+		$router->addResource('About', '/about');
+		$router->handle('/products');
+		$this->assertEquals(count($router->getRoutes()), 6);
+
+		$table = $router->getRouteTable();
+		$this->assertEquals(count($table['resources']), 3);
+		$this->assertTrue(isset($table['files'][__FILE__]));
+
+		/**
+		 * The routes are loaded from the cache, the annotations service isn't required
+		 */
+		$di = new Phalcon\DI();
+		$di['request'] = new Phalcon\Http\Request();
+
+		$router = new Phalcon\Mvc\Router\Annotations(false);
+		$router->setDI($di);
+		$router->setRoutesCache($cache);
+		$router->addResource('Robots', '/');
+		$router->addResource('Products', '/products');
+		$router->addResource('About', '/about');
+		$router->handle('/about');
+		$this->assertEquals(count($router->getRoutes()), 5);
+
+		$route = $router->getRouteByName('save-robot');
+		$this->assertTrue(is_object($route));
+		$this->assertEquals($route->getHttpMethods(), array('POST', 'PUT'));
+
+		$_SERVER['REQUEST_METHOD'] = 'POST';
+		$router->handle('/about/team');
+		$this->assertEquals($router->getControllerName(), 'about');
+		$this->assertEquals($router->getActionName(), 'teampost');
+
+		$_SERVER['REQUEST_METHOD'] = 'GET';
+		$router->handle('/robots/edit/100');
+		$this->assertEquals($router->getControllerName(), 'robots');
+		$this->assertEquals($router->getParams(), array('id' => '100'));
+
+		/**
+		 * A changed controller file rebuilds the table
+		 */
+		$table['files'][__FILE__] = md5('changed');
+		$table['resources'] = array();
+		$cache->save('changed-routes', $table);
+
+		$router->setDI($this->_getDI());
+		$router->setRoutesCache($cache, 'changed-routes');
+		$table = $router->getRouteTable();
+		$this->assertEquals(count($table['resources']), 3);
+		$this->assertEquals($table['files'][__FILE__], md5_file(__FILE__));
+	}
 }
@@ -364,6 +364,16 @@ class RouterMvcTest extends PHPUnit_Framework_TestCase
 		$this->assertEquals($usersAdd, $router->getRouteByName('usersAdd'));
 		$this->assertEquals($usersFind, $router->getRouteById(0));
 
+		//routes renamed or added after the first lookup
+		$usersAdd->setName('usersCreate');
+		$this->assertFalse($router->getRouteByName('usersAdd'));
+		$this->assertEquals($usersAdd, $router->getRouteByName('usersCreate'));
+
+		$usersEdit = $router->add('/api/users/edit')->setName('usersEdit');
+		$this->assertEquals($usersEdit, $router->getRouteByName('usersEdit'));
+		$this->assertEquals($usersEdit, $router->getRouteById(2));
+		$this->assertFalse($router->getRouteById(3));
+
 	}
 
 	public function testExtraSlashes()
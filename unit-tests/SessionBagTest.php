@@ -65,4 +65,64 @@ class SessionBagTest extends PHPUnit_Framework_TestCase
 		// Asserts
 		$this->assertEquals($value, $bag->a);
 	}
+
+	public function testDeferred()
+	{
+		\Phalcon\DI::reset();
+		new \Phalcon\DI\FactoryDefault();
+		@session_start();
+
+		// Changes are kept in the bag until they're written back
+		$bag = new Phalcon\Session\Bag('deferred', array('deferred' => true));
+		$bag->set('a', 'b');
+		$bag->c = 'd';
+		$this->assertEquals('b', $bag->get('a'));
+		$this->assertFalse(isset($_SESSION['deferred']));
+
+		$this->assertTrue($bag->write());
+		$this->assertEquals(array('a' => 'b', 'c' => 'd'), $_SESSION['deferred']);
+		$this->assertFalse($bag->write());
+
+		$this->assertTrue($bag->remove('a'));
+		$this->assertTrue($bag->write());
+		$this->assertEquals(array('c' => 'd'), $_SESSION['deferred']);
+
+		// Pending bags are written at once, as Application::reset() does in long running processes
+		$bag->set('e', 'f');
+		$other = new Phalcon\Session\Bag('other', array('deferred' => true));
+		$other->set('g', 'h');
+		$this->assertEquals(2, Phalcon\Session\Bag::writePending());
+		$this->assertEquals(array('c' => 'd', 'e' => 'f'), $_SESSION['deferred']);
+		$this->assertEquals(array('g' => 'h'), $_SESSION['other']);
+		$this->assertEquals(0, Phalcon\Session\Bag::writePending());
+	}
+
+	public function testStorage()
+	{
+		\Phalcon\DI::reset();
+		new \Phalcon\DI\FactoryDefault();
+		@session_start();
+
+		$storage = new Phalcon\Cache\Backend\Memory(new Phalcon\Cache\Frontend\Data());
+
+		// The bag is kept under its own key instead of the session
+		$bag = new Phalcon\Session\Bag('cart', array('storage' => $storage));
+		$bag->set('items', array(1, 2, 3));
+		$this->assertTrue($bag->write());
+		$this->assertFalse(isset($_SESSION['cart']));
+		$storageKey = $_SESSION['$PHALCON/BAG$'] . '_cart';
+		$this->assertEquals(array('items' => array(1, 2, 3)), $storage->get($storageKey));
+
+		$bag = new Phalcon\Session\Bag('cart', array('storage' => $storage));
+		$this->assertEquals(array(1, 2, 3), $bag->get('items'));
+
+		// The bag is still found after the session id changes
+		@session_regenerate_id();
+
+		$bag = new Phalcon\Session\Bag('cart', array('storage' => $storage));
+		$this->assertEquals(array(1, 2, 3), $bag->get('items'));
+
+		$bag->destroy();
+		$this->assertNull($storage->get($storageKey));
+	}
 }
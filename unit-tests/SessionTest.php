@@ -168,4 +168,178 @@ class SessionTest extends PHPUnit_Framework_TestCase
 
 	}
 
+	public function testSessionLazyReadOnly()
+	{
+		$session = new Phalcon\Session\Adapter\Files(array(
+			'lazy' => true,
+			'readOnly' => true
+		));
+
+		$this->assertTrue($session->isReadOnly());
+
+		// Headers were already sent, so the session can't be started even lazily
+		$this->assertFalse($session->start());
+		$this->assertFalse($session->isStarted());
+
+		$session = new Phalcon\Session\Adapter\Files();
+		$this->assertFalse($session->isReadOnly());
+	}
+
+	/**
+	 * @runInSeparateProcess
+	 * @preserveGlobalState disabled
+	 */
+	public function testSessionLazyStart()
+	{
+		if (headers_sent()) {
+			$this->markTestSkipped('Headers were already sent');
+			return;
+		}
+
+		ini_set('session.save_handler', 'files');
+		ini_set('session.save_path', __DIR__ . '/cache');
+
+		// set() starts the session
+		$session = new Phalcon\Session\Adapter\Files(array('lazy' => true));
+		$this->assertTrue($session->start());
+		$this->assertTrue($session->isStarted());
+		$this->assertEquals(session_id(), '');
+
+		$session->set('some', 'lazy-value');
+		$this->assertNotEquals(session_id(), '');
+
+		$sessionId = session_id();
+		session_write_close();
+
+		// get() starts the session
+		unset($_SESSION);
+		session_id($sessionId);
+		$session = new Phalcon\Session\Adapter\Files(array('lazy' => true));
+		$session->start();
+		$this->assertFalse(isset($_SESSION));
+		$this->assertEquals($session->get('some'), 'lazy-value');
+		session_write_close();
+
+		// A bag starts the session through the 'session' service
+		\Phalcon\DI::reset();
+		$di = new \Phalcon\DI\FactoryDefault();
+		$di->setShared('session', function() {
+			$session = new Phalcon\Session\Adapter\Files(array('lazy' => true));
+			$session->start();
+			return $session;
+		});
+
+		unset($_SESSION);
+		session_id($sessionId);
+		$bag = new Phalcon\Session\Bag('user');
+		$this->assertFalse(isset($_SESSION));
+		$this->assertNull($bag->get('name'));
+		$this->assertTrue(isset($_SESSION));
+
+		session_destroy();
+	}
+
+	/**
+	 * @runInSeparateProcess
+	 * @preserveGlobalState disabled
+	 */
+	public function testSessionReadOnly()
+	{
+		if (headers_sent()) {
+			$this->markTestSkipped('Headers were already sent');
+			return;
+		}
+
+		ini_set('session.save_handler', 'files');
+		ini_set('session.save_path', __DIR__ . '/cache');
+
+		$session = new Phalcon\Session\Adapter\Files();
+		$session->start();
+		$session->set('some', 'value');
+		$sessionId = $session->getId();
+		session_write_close();
+
+		// The session is read and closed, changes are not written back
+		session_id($sessionId);
+		$session = new Phalcon\Session\Adapter\Files(array('readOnly' => true));
+		$this->assertTrue($session->start());
+		$this->assertEquals($session->get('some'), 'value');
+
+		$session->set('some', 'changed');
+		session_write_close();
+
+		session_id($sessionId);
+		$session = new Phalcon\Session\Adapter\Files();
+		$session->start();
+		$this->assertEquals($session->get('some'), 'value');
+
+		session_destroy();
+	}
+
+	protected function _getLibmemcachedSession(array $options = array())
+	{
+		if (!extension_loaded('memcached')) {
+			$this->markTestSkipped('Warning: memcached extension is not loaded');
+			return false;
+		}
+
+		$options['servers'] = array(
+			array('host' => '127.0.0.1', 'port' => 11211, 'weight' => 1)
+		);
+
+		return new Phalcon\Session\Adapter\Libmemcached($options);
+	}
+
+	public function testSessionLibmemcachedWriteUnchanged()
+	{
+		$session = $this->_getLibmemcachedSession(array(
+			'client' => array(Memcached::OPT_BINARY_PROTOCOL => true)
+		));
+		$cache = $session->getLibmemcached();
+		$sessionId = 'unchanged-' . uniqid();
+
+		// Empty new sessions are not stored
+		$this->assertNull($session->read($sessionId));
+		$this->assertTrue($session->write($sessionId, ''));
+		$this->assertNull($cache->get($sessionId));
+
+		$this->assertTrue($session->write($sessionId, 'some|s:5:"value";'));
+		$this->assertEquals($cache->get($sessionId), 'some|s:5:"value";');
+
+		// Unchanged data only refreshes the lifetime, the stored content isn't sent again
+		$this->assertEquals($session->read($sessionId), 'some|s:5:"value";');
+		$cache->save($sessionId, 'other|s:5:"value";');
+		$this->assertTrue($session->write($sessionId, 'some|s:5:"value";'));
+		$this->assertEquals($cache->get($sessionId), 'other|s:5:"value";');
+
+		// If the entry is gone the session is saved again
+		$this->assertEquals($session->read($sessionId), 'other|s:5:"value";');
+		$cache->delete($sessionId);
+		$this->assertTrue($session->write($sessionId, 'other|s:5:"value";'));
+		$this->assertEquals($cache->get($sessionId), 'other|s:5:"value";');
+
+		$session->destroy($sessionId);
+	}
+
+	public function testSessionLibmemcachedCas()
+	{
+		$session = $this->_getLibmemcachedSession(array('cas' => true));
+		$cache = $session->getLibmemcached();
+		$sessionId = 'cas-' . uniqid();
+
+		$this->assertNull($session->read($sessionId));
+		$this->assertTrue($session->write($sessionId, 'some|s:5:"value";'));
+
+		$this->assertEquals($session->read($sessionId), 'some|s:5:"value";');
+		$this->assertTrue($session->write($sessionId, 'some|s:6:"value2";'));
+
+		// Another request changed the session after it was read
+		$this->assertEquals($session->read($sessionId), 'some|s:6:"value2";');
+		$cache->save($sessionId, 'some|s:6:"value3";');
+		$this->assertFalse($session->write($sessionId, 'some|s:6:"value4";'));
+		$this->assertEquals($cache->get($sessionId), 'some|s:6:"value3";');
+
+		$session->destroy($sessionId);
+	}
+
 }
@@ -997,4 +997,71 @@ class ValidationTest extends PHPUnit_Framework_TestCase
 
 		$this->assertEquals($expectedMessages, $messages);
 	}
+
+	public function testValidationBatch()
+	{
+		$validation = new Phalcon\Validation();
+
+		$validation
+			->add('name', new PresenceOf(array(
+				'message' => 'The name is required',
+				'cancelOnFail' => true
+			)))
+			->add('name', new StringLength(array(
+				'min' => 3,
+				'messageMinimum' => 'The name is too short'
+			)))
+			->add('status', new InclusionIn(array(
+				'domain' => array('A', 'B')
+			)))
+			->add('price', new Phalcon\Validation\Validator\Numericality(array(
+				'allowEmpty' => true
+			)))
+			->add('code', new Regex(array(
+				'pattern' => '/[A-Z]{2}[0-9]+/'
+			)))
+			->add('email', new Email(array()));
+
+		$validation->setFilters('name', 'trim');
+
+		$rows = array(
+			'first' => array('name' => 'Peter', 'status' => 'A', 'price' => '10.5', 'code' => 'AB12', 'email' => 'peter@example.com'),
+			'second' => array('name' => 'Jo', 'status' => 'C', 'price' => '', 'code' => 'ab12', 'email' => 'peter'),
+			'third' => (object) array('name' => ' Al ', 'status' => 'B', 'price' => 'ten', 'code' => 'XY9', 'email' => 'al@example.com'),
+			'fourth' => array('name' => '  ', 'status' => 'C')
+		);
+
+		$batch = $validation->validateBatch($rows);
+
+		$this->assertInstanceOf('Phalcon\Validation\Batch', $batch);
+		$this->assertFalse($batch->isValid());
+		$this->assertEquals(count($batch), 3);
+		$this->assertEquals($batch->getFailedRows(), array('fourth', 'second', 'third'));
+
+		$this->assertEquals($batch->getBitmap('first'), 0);
+		$this->assertEquals($batch->getBitmap('second'), 2 | 4 | 16 | 32);
+		$this->assertEquals($batch->getBitmap('third'), 2 | 8);
+
+		$this->assertEquals(count($batch->getMessages('first')), 0);
+
+		$messages = $batch->getMessages('third');
+		$this->assertEquals(count($messages), 2);
+		$this->assertEquals($messages[0]->getType(), 'TooShort');
+		$this->assertEquals($messages[0]->getMessage(), 'The name is too short');
+		$this->assertEquals($messages[1]->getType(), 'Numericality');
+
+		$messages = $batch->getMessages('second');
+		$this->assertEquals(count($messages), 4);
+		$this->assertEquals($messages[1]->getType(), 'InclusionIn');
+		$this->assertEquals($messages[3]->getField(), 'email');
+
+		//A failed validator with 'cancelOnFail' skips the rest of the validators of the row
+		$this->assertEquals($batch->getBitmap('fourth'), 1);
+		$messages = $batch->getMessages('fourth');
+		$this->assertEquals(count($messages), 1);
+		$this->assertEquals($messages[0]->getMessage(), 'The name is required');
+
+		$batch = $validation->validateBatch(array($rows['first']));
+		$this->assertTrue($batch->isValid());
+	}
 }
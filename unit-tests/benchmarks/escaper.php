@@ -0,0 +1,57 @@
+<?php
+
+/*
+  +------------------------------------------------------------------------+
+  | Phalcon Framework                                                      |
+  +------------------------------------------------------------------------+
+  | Copyright (c) 2011-2015 Phalcon Team (http://www.phalconphp.com)       |
+  +------------------------------------------------------------------------+
+  | This source file is subject to the New BSD License that is bundled     |
+  | with this package in the file docs/LICENSE.txt.                        |
+  |                                                                        |
+  | If you did not receive a copy of the license and are unable to         |
+  | obtain it through the world-wide-web, please send an email             |
+  | to license@phalconphp.com so we can send you a copy immediately.       |
+  +------------------------------------------------------------------------+
+*/
+
+/**
+ * Microbenchmark for Phalcon\Escaper::escapeJs and Phalcon\Escaper::escapeCss
+ *
+ *    php unit-tests/benchmarks/escaper.php [iterations]
+ */
+
+if (!extension_loaded('phalcon')) {
+	die('The phalcon extension is not loaded' . PHP_EOL);
+}
+
+$iterations = isset($argv[1]) ? (int) $argv[1] : 20000;
+
+$payloads = array(
+	'identifier' => 'userProfileName42',
+	'sentence' => 'Welcome back, Jane Doe! You have 3 new messages and 12 notifications.',
+	'url' => 'https://www.example.com/search?q=phalcon+framework&page=2&sort=desc#results',
+	'html' => str_repeat('<div class="card"><h2 title="Product details">Product name</h2><p>Lorem ipsum dolor sit amet, consectetur adipiscing elit</p></div>', 8),
+	'js' => str_repeat("var items = document.getElementsByTagName('li'); for (var i = 0; i < items.length; i++) { items[i].className = 'active'; }", 8),
+	'utf8' => str_repeat('Ça coûte 12€ — naïve façade, résumé déjà vu ', 8),
+	'alnum' => str_repeat('abcdefghijklmnopqrstuvwxyzABCDEFGHIJKLMNOPQRSTUVWXYZ0123456789', 16)
+);
+
+$escaper = new Phalcon\Escaper();
+
+printf("%-12s %8s %12s %12s" . PHP_EOL, 'payload', 'bytes', 'js (us)', 'css (us)');
+
+foreach ($payloads as $name => $payload) {
+
+	$times = array();
+	foreach (array('escapeJs', 'escapeCss') as $method) {
+		$escaper->$method($payload);
+		$start = microtime(true);
+		for ($i = 0; $i < $iterations; $i++) {
+			$escaper->$method($payload);
+		}
+		$times[] = (microtime(true) - $start) * 1000000 / $iterations;
+	}
+
+	printf("%-12s %8d %12.3f %12.3f" . PHP_EOL, $name, strlen($payload), $times[0], $times[1]);
+}
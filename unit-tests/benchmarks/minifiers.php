@@ -0,0 +1,87 @@
+<?php
+
+/*
+  +------------------------------------------------------------------------+
+  | Phalcon Framework                                                      |
+  +------------------------------------------------------------------------+
+  | Copyright (c) 2011-2015 Phalcon Team (http://www.phalconphp.com)       |
+  +------------------------------------------------------------------------+
+  | This source file is subject to the New BSD License that is bundled     |
+  | with this package in the file docs/LICENSE.txt.                        |
+  |                                                                        |
+  | If you did not receive a copy of the license and are unable to         |
+  | obtain it through the world-wide-web, please send an email             |
+  | to license@phalconphp.com so we can send you a copy immediately.       |
+  +------------------------------------------------------------------------+
+*/
+
+/**
+ * Throughput of Phalcon\Assets\Filters\Jsmin and Phalcon\Assets\Filters\Cssmin
+ *
+ *    php unit-tests/benchmarks/minifiers.php [size in MB] [baseline.json]
+ *
+ * When the baseline file does not exist the results are saved into it, so running the
+ * script once with the previous build and again with the current one compares both filters
+ */
+
+if (!extension_loaded('phalcon')) {
+	die('The phalcon extension is not loaded' . PHP_EOL);
+}
+
+$size = (isset($argv[1]) ? (float) $argv[1] : 2) * 1048576;
+$baselineFile = isset($argv[2]) ? $argv[2] : null;
+
+$samples = array(
+	'js source' => array('Jsmin', "/* helpers */\nfunction foo(bar, baz) {\n\tvar result = bar + baz; // sum\n\tif (result > 10) {\n\t\treturn 'large value: ' + result;\n\t}\n\treturn document.getElementById(\"item\").value;\n}\n"),
+	'js minified' => array('Jsmin', "function foo(bar,baz){var result=bar+baz;if(result>10){return'large value: '+result;}return document.getElementById(\"item\").value;}\n"),
+	'css source' => array('Cssmin', "/* grid */\n.navbar .nav > li > a {\n\tcolor: #111;\n\tbackground: url(data:image/png;base64,AAAA);\n\ttext-decoration: underline;\n}\n\n@media print {\n\t.hidden-print {\n\t\tdisplay: none;\n\t}\n}\n"),
+	'css minified' => array('Cssmin', ".navbar .nav>li>a{color:#111;background:url(data:image/png;base64,AAAA);text-decoration:underline}@media print{.hidden-print{display:none}}\n")
+);
+
+$baseline = array();
+if ($baselineFile && file_exists($baselineFile)) {
+	$baseline = json_decode(file_get_contents($baselineFile), true);
+}
+
+$source = tempnam(sys_get_temp_dir(), 'min');
+$target = tempnam(sys_get_temp_dir(), 'min');
+
+printf("%-14s %10s %12s %12s %12s" . PHP_EOL, 'sample', 'bytes', 'MB/s', 'file MB/s', 'baseline');
+
+$results = array();
+foreach ($samples as $name => $sample) {
+
+	$className = 'Phalcon\Assets\Filters\\' . $sample[0];
+	$filter = new $className();
+
+	$content = str_repeat($sample[1], (int) ceil($size / strlen($sample[1])));
+
+	$start = microtime(true);
+	$filter->filter($content);
+	$results[$name] = strlen($content) / 1048576 / (microtime(true) - $start);
+
+	$fileRate = 0;
+	if (method_exists($filter, 'filterFile')) {
+		file_put_contents($source, $content);
+		$start = microtime(true);
+		$filter->filterFile($source, $target);
+		$fileRate = strlen($content) / 1048576 / (microtime(true) - $start);
+	}
+
+	printf(
+		"%-14s %10d %12.1f %12.1f %12s" . PHP_EOL,
+		$name,
+		strlen($content),
+		$results[$name],
+		$fileRate,
+		isset($baseline[$name]) ? sprintf('%.1f', $baseline[$name]) : '-'
+	);
+}
+
+unlink($source);
+unlink($target);
+
+if ($baselineFile && !$baseline) {
+	file_put_contents($baselineFile, json_encode($results));
+	echo 'Results saved to ', $baselineFile, PHP_EOL;
+}
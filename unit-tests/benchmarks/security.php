@@ -0,0 +1,78 @@
+<?php
+
+/*
+  +------------------------------------------------------------------------+
+  | Phalcon Framework                                                      |
+  +------------------------------------------------------------------------+
+  | Copyright (c) 2011-2015 Phalcon Team (http://www.phalconphp.com)       |
+  +------------------------------------------------------------------------+
+  | This source file is subject to the New BSD License that is bundled     |
+  | with this package in the file docs/LICENSE.txt.                        |
+  |                                                                        |
+  | If you did not receive a copy of the license and are unable to         |
+  | obtain it through the world-wide-web, please send an email             |
+  | to license@phalconphp.com so we can send you a copy immediately.       |
+  +------------------------------------------------------------------------+
+*/
+
+/**
+ * Cost of Phalcon\Security::hash() and Phalcon\Security::checkHash() per work factor
+ *
+ *    php unit-tests/benchmarks/security.php [target in ms] [passwords per work factor]
+ *
+ * The work factor picked by Phalcon\Security::calibrateWorkFactor() for the target is
+ * printed after the table, running the script in every machine shows how the login
+ * latency changes with the hardware
+ */
+
+if (!extension_loaded('phalcon')) {
+	die('The phalcon extension is not loaded' . PHP_EOL);
+}
+
+$target = isset($argv[1]) ? (int) $argv[1] : 250;
+$count = isset($argv[2]) ? (int) $argv[2] : 10;
+
+$security = new Phalcon\Security();
+
+$passwords = array();
+for ($i = 0; $i < $count; $i++) {
+	$passwords[] = 'password-' . $i;
+}
+
+printf("%-12s %12s %12s" . PHP_EOL, 'work factor', 'hash ms', 'check ms');
+
+for ($workFactor = 4; $workFactor <= 31; $workFactor++) {
+
+	$hashes = array();
+
+	$start = microtime(true);
+	foreach ($passwords as $password) {
+		$hashes[] = $security->hash($password, $workFactor);
+	}
+	$hashTime = (microtime(true) - $start) * 1000 / $count;
+
+	$start = microtime(true);
+	foreach ($passwords as $i => $password) {
+		if (!$security->checkHash($password, $hashes[$i])) {
+			die('The hash of ' . $password . ' could not be verified' . PHP_EOL);
+		}
+	}
+	$checkTime = (microtime(true) - $start) * 1000 / $count;
+
+	printf("%-12d %12.2f %12.2f" . PHP_EOL, $workFactor, $hashTime, $checkTime);
+
+	// The next work factor would take twice the time
+	if ($hashTime > $target) {
+		break;
+	}
+}
+
+$start = microtime(true);
+$workFactor = $security->calibrateWorkFactor($target);
+
+printf(
+	PHP_EOL . "calibrateWorkFactor(%d) = %d in %.1f ms" . PHP_EOL,
+	$target,
+	$workFactor,
+	(microtime(true) - $start) * 1000
+);